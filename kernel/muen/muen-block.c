@@ -35,6 +35,47 @@ int solo5_blk_read_sync(uint64_t sec __attribute__((unused)),
     return -1;
 }
 
+int solo5_blk_writev(struct solo5_blk_seg *segs __attribute__((unused)),
+                     int n __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_readv(struct solo5_blk_seg *segs __attribute__((unused)),
+                    int n __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_submit(const struct solo5_blk_req *reqs __attribute__((unused)),
+                     int n __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_reap(struct solo5_blk_completion *c __attribute__((unused)),
+                   int n __attribute__((unused)))
+{
+    return 0;
+}
+
+int solo5_blk_flush(void)
+{
+    return -1;
+}
+
+int solo5_blk_discard(uint64_t sec __attribute__((unused)),
+                      uint64_t count __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_write_zeroes(uint64_t sec __attribute__((unused)),
+                           uint64_t count __attribute__((unused)))
+{
+    return -1;
+}
+
 int solo5_blk_sector_size(void)
 {
     return -1;
@@ -49,3 +90,73 @@ int solo5_blk_rw(void)
 {
     return -1;
 }
+
+const uint8_t *solo5_blk_map(void)
+{
+    return NULL;
+}
+
+int solo5_blk_open(const char *name __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_info(int handle __attribute__((unused)),
+                   struct solo5_blk_info *info __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_write(int handle __attribute__((unused)),
+                    uint64_t sec __attribute__((unused)),
+                    const uint8_t *data __attribute__((unused)),
+                    int n __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_read(int handle __attribute__((unused)),
+                   uint64_t sec __attribute__((unused)),
+                   uint8_t *data __attribute__((unused)),
+                   int n __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_writev_h(int handle __attribute__((unused)),
+                       struct solo5_blk_seg *segs __attribute__((unused)),
+                       int n __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_readv_h(int handle __attribute__((unused)),
+                      struct solo5_blk_seg *segs __attribute__((unused)),
+                      int n __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_flush_h(int handle __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_discard_h(int handle __attribute__((unused)),
+                        uint64_t sec __attribute__((unused)),
+                        uint64_t count __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_write_zeroes_h(int handle __attribute__((unused)),
+                             uint64_t sec __attribute__((unused)),
+                             uint64_t count __attribute__((unused)))
+{
+    return -1;
+}
+
+const uint8_t *solo5_blk_map_h(int handle __attribute__((unused)))
+{
+    return NULL;
+}
@@ -55,6 +55,81 @@ int solo5_net_write_sync(uint8_t *data, int n);
  */
 int solo5_net_read_sync(uint8_t *data, int *n);
 
+/*
+ * Describes a single network packet for batched I/O: (data) points to the
+ * packet buffer of size (len).
+ */
+struct solo5_net_frame {
+    uint8_t *data;
+    int len;
+};
+
+/*
+ * Send up to (n) network packets described by (*frames). Returns the number of
+ * packets sent, or -1 on failure.
+ *
+ * On ukvm, up to 64 packets are sent per VM exit.
+ */
+int solo5_net_write_batch(struct solo5_net_frame *frames, int n);
+
+/*
+ * Receive up to (n) network packets into the buffers described by (*frames).
+ * On input (frames[i].len) is the size of each buffer, on output it is set to
+ * the size of the received packet. Returns the number of packets received,
+ * or 0 if no packets are available.
+ */
+int solo5_net_read_batch(struct solo5_net_frame *frames, int n);
+
+/*
+ * Per-packet offload header, laid out as struct virtio_net_hdr. For
+ * transmitted packets, (flags) may request that a checksum be computed over
+ * the data starting at (csum_start) and stored at (csum_start + csum_offset),
+ * and (gso_type) may request that a TCP packet is segmented into (gso_size)
+ * byte payloads, each prefixed by the first (hdr_len) bytes of headers. For
+ * received packets, the same fields describe what is left to be done.
+ */
+#define SOLO5_NET_HDR_F_NEEDS_CSUM  1
+#define SOLO5_NET_HDR_F_DATA_VALID  2
+#define SOLO5_NET_HDR_GSO_NONE      0
+#define SOLO5_NET_HDR_GSO_TCPV4     1
+#define SOLO5_NET_HDR_GSO_TCPV6     4
+#define SOLO5_NET_HDR_GSO_ECN       0x80
+
+struct solo5_net_hdr {
+    uint8_t flags;
+    uint8_t gso_type;
+    uint16_t hdr_len;
+    uint16_t gso_size;
+    uint16_t csum_start;
+    uint16_t csum_offset;
+};
+
+#define SOLO5_NET_OFFLOAD_CSUM      (1U << 0)
+#define SOLO5_NET_OFFLOAD_TSO4      (1U << 1)
+#define SOLO5_NET_OFFLOAD_TSO6      (1U << 2)
+
+/*
+ * Returns the set of SOLO5_NET_OFFLOAD_* supported by the network device, or 0
+ * if offloads are not available.
+ */
+unsigned solo5_net_offloads(void);
+
+/*
+ * As solo5_net_write_sync(), but the packet is described by the offload header
+ * (*hdr), and may be up to 64kB in size if segmentation is requested. Returns
+ * -1 if offloads are not supported.
+ */
+int solo5_net_write_offload(const struct solo5_net_hdr *hdr, uint8_t *data,
+        int n);
+
+/*
+ * As solo5_net_read_sync(), but also returns the offload header of the
+ * received packet in (*hdr). Once this has been called, received packets may
+ * have partial checksums and be up to 64kB in size, so the buffer should be
+ * sized accordingly. Returns -1 if offloads are not supported.
+ */
+int solo5_net_read_offload(struct solo5_net_hdr *hdr, uint8_t *data, int *n);
+
 /*
  * Returns a pointer to the network MAC address, formatted as a C string
  * XX:XX:XX:XX:XX:XX.
@@ -82,6 +157,91 @@ int solo5_blk_write_sync(uint64_t sec, uint8_t *data, int n);
  */
 int solo5_blk_read_sync(uint64_t sec, uint8_t *data, int *n);
 
+/*
+ * Scatter-gather block I/O segment: (len) bytes at (data), starting at the
+ * sector (sector).
+ */
+struct solo5_blk_seg {
+    uint64_t sector;
+    uint8_t *data;
+    int len;
+};
+
+/*
+ * Write or read the (n) segments described by (*segs). Returns 0 on success,
+ * -1 on error, in which case some segments may have been transferred.
+ *
+ * On ukvm, up to 64 segments are transferred per VM exit, and segments which
+ * are adjacent on disk are transferred by a single host I/O operation.
+ */
+int solo5_blk_writev(struct solo5_blk_seg *segs, int n);
+int solo5_blk_readv(struct solo5_blk_seg *segs, int n);
+
+/*
+ * Asynchronous block I/O. Requests are queued with solo5_blk_submit() and may
+ * complete in any order. solo5_poll() returns 1 when completions are
+ * available, which are then collected with solo5_blk_reap(). The buffer of
+ * each request must remain valid until its completion has been collected.
+ *
+ * Requests are not ordered with respect to each other; in particular a
+ * SOLO5_BLK_OP_FLUSH only covers writes which completed before it was
+ * submitted.
+ */
+#define SOLO5_BLK_OP_READ   0
+#define SOLO5_BLK_OP_WRITE  1
+#define SOLO5_BLK_OP_FLUSH  2   /* As solo5_blk_flush(); no data */
+
+struct solo5_blk_req {
+    uint64_t id;                /* Returned in the completion */
+    int handle;                 /* As returned by solo5_blk_open() */
+    int op;
+    uint64_t sector;
+    uint8_t *data;
+    int len;
+};
+
+struct solo5_blk_completion {
+    uint64_t id;
+    int ret;                    /* 0 on success, -1 on error */
+};
+
+/*
+ * Queue up to (n) requests described by (*reqs). Returns the number of
+ * requests queued, which is less than (n) if too many requests are
+ * outstanding, or -1 if asynchronous I/O is not supported.
+ *
+ * On ukvm, up to 128 requests may be outstanding, including those whose
+ * completions have not yet been collected.
+ */
+int solo5_blk_submit(const struct solo5_blk_req *reqs, int n);
+
+/*
+ * Collect up to (n) completions into (*c). Returns the number collected.
+ */
+int solo5_blk_reap(struct solo5_blk_completion *c, int n);
+
+/*
+ * Make all writes to the block device which have completed durable, i.e.
+ * ensure that they are not lost if the host crashes. Returns 0 on success, -1
+ * on error.
+ */
+int solo5_blk_flush(void);
+
+/*
+ * Discard the contents of (count) sectors starting at the sector (sec),
+ * allowing the host to release the storage used by them. Discarded sectors
+ * read back as either zeroes or their previous contents. Returns 0 on
+ * success, -1 on error.
+ */
+int solo5_blk_discard(uint64_t sec, uint64_t count);
+
+/*
+ * Set (count) sectors starting at the sector (sec) to zeroes. On ukvm, this
+ * is done without transferring any data where possible. Returns 0 on
+ * success, -1 on error.
+ */
+int solo5_blk_write_zeroes(uint64_t sec, uint64_t count);
+
 /*
  * Returns the block device sector size.
  */
@@ -97,6 +257,66 @@ uint64_t solo5_blk_sectors(void);
  */
 int solo5_blk_rw(void);
 
+/*
+ * Returns a pointer to a read-only mapping of the whole block device, or NULL
+ * if the block device is not mapped. Writes to the block device are visible
+ * in the mapping once they have completed. The mapping must not be written
+ * to, nor passed as a buffer to other Solo5 calls.
+ *
+ * On ukvm, the block device is mapped with --disk-map, in which case
+ * solo5_blk_read_sync() and solo5_blk_readv() also copy from the mapping
+ * rather than exiting to the monitor.
+ */
+const uint8_t *solo5_blk_map(void);
+
+/*
+ * Multiple block devices. Each block device is identified by a handle, which
+ * is obtained by name with solo5_blk_open(). The default block device, which
+ * the functions above operate on, has the handle 0. Handles remain valid for
+ * the lifetime of the unikernel.
+ *
+ * On ukvm, block devices are given as --disk=[NAME:]IMAGE; the first one is
+ * the default block device, and unnamed ones have the empty name "". On
+ * virtio, only the default block device, with the empty name, is supported.
+ */
+
+/*
+ * Returns the handle of the block device (name), or -1 if there is no such
+ * device.
+ */
+int solo5_blk_open(const char *name);
+
+struct solo5_blk_info {
+    int sector_size;
+    uint64_t sectors;           /* Size in sectors */
+    int rw;                     /* True if writable */
+};
+
+/*
+ * Fills in (*info) for the block device (handle). Returns 0 on success, -1 if
+ * (handle) is not valid.
+ */
+int solo5_blk_info(int handle, struct solo5_blk_info *info);
+
+/*
+ * Writes or reads (n) bytes to or from the block device (handle), as
+ * solo5_blk_write_sync() and solo5_blk_read_sync(). Returns 0 on success, -1
+ * on error.
+ */
+int solo5_blk_write(int handle, uint64_t sec, const uint8_t *data, int n);
+int solo5_blk_read(int handle, uint64_t sec, uint8_t *data, int n);
+
+/*
+ * As the functions above without the _h suffix, on the block device (handle).
+ * Return -1 if (handle) is not valid; solo5_blk_map_h() returns NULL.
+ */
+int solo5_blk_writev_h(int handle, struct solo5_blk_seg *segs, int n);
+int solo5_blk_readv_h(int handle, struct solo5_blk_seg *segs, int n);
+int solo5_blk_flush_h(int handle);
+int solo5_blk_discard_h(int handle, uint64_t sec, uint64_t count);
+int solo5_blk_write_zeroes_h(int handle, uint64_t sec, uint64_t count);
+const uint8_t *solo5_blk_map_h(int handle);
+
 /*
  * Console I/O.
  */
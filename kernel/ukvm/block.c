@@ -20,11 +20,57 @@
 
 #include "kernel.h"
 
-/* ukvm block interface */
-int solo5_blk_write_sync(uint64_t sec, uint8_t *data, int n)
+/*
+ * Read-only mappings of the disks (--disk-map), looked up on first use.
+ */
+static struct {
+    int checked;
+    const uint8_t *base;            /* NULL if the disk is not mapped */
+    uint64_t size;
+    size_t sector_size;
+} blkmap[UKVM_BLK_MAX];
+
+static const uint8_t *blkmap_get(int handle)
+{
+    volatile struct ukvm_blkinfo info;
+
+    if (handle < 0 || handle >= UKVM_BLK_MAX)
+        return NULL;
+    if (!blkmap[handle].checked) {
+        info.handle = handle;
+        info.map = 0;
+        ukvm_do_hypercall(UKVM_HYPERCALL_BLKINFO, &info);
+        blkmap[handle].base = (const uint8_t *)info.map;
+        blkmap[handle].size = info.num_sectors * info.sector_size;
+        blkmap[handle].sector_size = info.sector_size;
+        blkmap[handle].checked = 1;
+    }
+    return blkmap[handle].base;
+}
+
+/*
+ * Returns a pointer to (len) bytes at sector (sec) in the mapping of disk
+ * (handle), or NULL if the disk is not mapped or the range is not within it.
+ */
+static const uint8_t *blkmap_range(int handle, uint64_t sec, int len)
+{
+    uint64_t off;
+
+    if (blkmap_get(handle) == NULL || len < 0)
+        return NULL;
+    if (sec >= blkmap[handle].size / blkmap[handle].sector_size)
+        return NULL;
+    off = sec * blkmap[handle].sector_size;
+    if ((uint64_t)len > blkmap[handle].size - off)
+        return NULL;
+    return blkmap[handle].base + off;
+}
+
+static int blk_write(int handle, uint64_t sec, const uint8_t *data, int n)
 {
     volatile struct ukvm_blkwrite wr;
 
+    wr.handle = handle;
     wr.sector = sec;
     wr.data = data;
     wr.len = n;
@@ -35,10 +81,17 @@ int solo5_blk_write_sync(uint64_t sec, uint8_t *data, int n)
     return wr.ret;
 }
 
-int solo5_blk_read_sync(uint64_t sec, uint8_t *data, int *n)
+static int blk_read(int handle, uint64_t sec, uint8_t *data, int *n)
 {
     volatile struct ukvm_blkread rd;
+    const uint8_t *p = blkmap_range(handle, sec, *n);
 
+    if (p != NULL) {
+        memcpy(data, p, *n);
+        return 0;
+    }
+
+    rd.handle = handle;
     rd.sector = sec;
     rd.data = data;
     rd.len = *n;
@@ -50,10 +103,272 @@ int solo5_blk_read_sync(uint64_t sec, uint8_t *data, int *n)
     return rd.ret;
 }
 
+/* ukvm block interface */
+int solo5_blk_write_sync(uint64_t sec, uint8_t *data, int n)
+{
+    return blk_write(0, sec, data, n);
+}
+
+int solo5_blk_read_sync(uint64_t sec, uint8_t *data, int *n)
+{
+    return blk_read(0, sec, data, n);
+}
+
+int solo5_blk_open(const char *name)
+{
+    volatile struct ukvm_blkopen o;
+    size_t len = strlen(name);
+
+    if (len >= UKVM_BLK_NAME_MAX)
+        return -1;
+    memset((void *)o.name, 0, sizeof o.name);
+    memcpy((void *)o.name, name, len);
+    o.handle = -1;
+    o.ret = 0;
+
+    ukvm_do_hypercall(UKVM_HYPERCALL_BLKOPEN, &o);
+
+    return o.ret == 0 ? o.handle : -1;
+}
+
+int solo5_blk_info(int handle, struct solo5_blk_info *info)
+{
+    volatile struct ukvm_blkinfo bi;
+
+    bi.handle = handle;
+    ukvm_do_hypercall(UKVM_HYPERCALL_BLKINFO, &bi);
+    if (bi.sector_size == 0)
+        return -1;
+
+    info->sector_size = bi.sector_size;
+    info->sectors = bi.num_sectors;
+    info->rw = bi.rw;
+    return 0;
+}
+
+int solo5_blk_write(int handle, uint64_t sec, const uint8_t *data, int n)
+{
+    return blk_write(handle, sec, data, n);
+}
+
+int solo5_blk_read(int handle, uint64_t sec, uint8_t *data, int n)
+{
+    return blk_read(handle, sec, data, &n);
+}
+
+static int blk_transfer_segs(int nr, int handle, struct solo5_blk_seg *segs,
+        int n)
+{
+    struct ukvm_blkseg seg[UKVM_BLKSEG_MAX];
+    volatile struct ukvm_blkwritev v;
+    int i, cnt;
+
+    /*
+     * UKVM_HYPERCALL_BLKREADV takes the same arguments.
+     */
+    while (n > 0) {
+        cnt = n > UKVM_BLKSEG_MAX ? UKVM_BLKSEG_MAX : n;
+        for (i = 0; i < cnt; i++) {
+            if (segs[i].len < 0)
+                return -1;
+            seg[i].sector = segs[i].sector;
+            seg[i].data = segs[i].data;
+            seg[i].len = segs[i].len;
+        }
+
+        v.handle = handle;
+        v.segs = seg;
+        v.nsegs = cnt;
+        v.ret = 0;
+
+        ukvm_do_hypercall(nr, &v);
+
+        if (v.ret != 0)
+            return -1;
+        segs += cnt;
+        n -= cnt;
+    }
+    return 0;
+}
+
+int solo5_blk_writev_h(int handle, struct solo5_blk_seg *segs, int n)
+{
+    return blk_transfer_segs(UKVM_HYPERCALL_BLKWRITEV, handle, segs, n);
+}
+
+int solo5_blk_readv_h(int handle, struct solo5_blk_seg *segs, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if (blkmap_range(handle, segs[i].sector, segs[i].len) == NULL)
+            break;
+    }
+    if (i == n) {
+        for (i = 0; i < n; i++)
+            memcpy(segs[i].data,
+                    blkmap_range(handle, segs[i].sector, segs[i].len),
+                    segs[i].len);
+        return 0;
+    }
+    return blk_transfer_segs(UKVM_HYPERCALL_BLKREADV, handle, segs, n);
+}
+
+int solo5_blk_writev(struct solo5_blk_seg *segs, int n)
+{
+    return solo5_blk_writev_h(0, segs, n);
+}
+
+int solo5_blk_readv(struct solo5_blk_seg *segs, int n)
+{
+    return solo5_blk_readv_h(0, segs, n);
+}
+
+/*
+ * Asynchronous I/O ring, set up on first use. (blkring_active) is 1 once set
+ * up, or -1 if the monitor does not support it.
+ */
+static struct ukvm_blkring blkring __attribute__((aligned(64)));
+static int blkring_active;
+static uint32_t blkring_outstanding;
+
+static int blkring_configure(void)
+{
+    volatile struct ukvm_blkring_setup r;
+
+    if (blkring_active)
+        return blkring_active == 1 ? 0 : -1;
+
+    r.ring = &blkring;
+    r.ret = 0;
+    ukvm_do_hypercall(UKVM_HYPERCALL_BLKRING, &r);
+    blkring_active = (r.ret == 0) ? 1 : -1;
+    return r.ret;
+}
+
+int blk_ring_pending(void)
+{
+    if (blkring_active != 1)
+        return 0;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    return __atomic_load_n(&blkring.cq_prod, __ATOMIC_ACQUIRE) !=
+        blkring.cq_cons;
+}
+
+int solo5_blk_submit(const struct solo5_blk_req *reqs, int n)
+{
+    volatile struct ukvm_blksubmit s;
+    uint32_t prod;
+    int i;
+
+    if (blkring_configure() != 0)
+        return -1;
+
+    prod = blkring.sq_prod;
+    for (i = 0; i < n; i++) {
+        struct ukvm_blksqe *sqe = &blkring.sq[prod % UKVM_BLKRING_ENTRIES];
+
+        if (blkring_outstanding == UKVM_BLKRING_ENTRIES)
+            break;
+        /*
+         * Invalid requests are completed with an error by the monitor.
+         */
+        sqe->id = reqs[i].id;
+        sqe->handle = reqs[i].handle;
+        sqe->op = reqs[i].op;
+        sqe->sector = reqs[i].sector;
+        sqe->data = reqs[i].data;
+        sqe->len = reqs[i].len;
+        prod++;
+        blkring_outstanding++;
+    }
+    if (i == 0)
+        return 0;
+
+    __atomic_store_n(&blkring.sq_prod, prod, __ATOMIC_RELEASE);
+    s.ret = 0;
+    ukvm_do_hypercall(UKVM_HYPERCALL_BLKSUBMIT, &s);
+    return s.ret == 0 ? i : -1;
+}
+
+int solo5_blk_reap(struct solo5_blk_completion *c, int n)
+{
+    uint32_t cons, prod;
+    int i;
+
+    if (blkring_active != 1)
+        return 0;
+
+    cons = blkring.cq_cons;
+    prod = __atomic_load_n(&blkring.cq_prod, __ATOMIC_ACQUIRE);
+    for (i = 0; i < n && cons != prod; i++, cons++) {
+        struct ukvm_blkcqe *cqe = &blkring.cq[cons % UKVM_BLKRING_ENTRIES];
+
+        c[i].id = cqe->id;
+        c[i].ret = cqe->ret;
+    }
+    __atomic_store_n(&blkring.cq_cons, cons, __ATOMIC_RELEASE);
+    blkring_outstanding -= i;
+    return i;
+}
+
+int solo5_blk_flush_h(int handle)
+{
+    volatile struct ukvm_blkflush fl;
+
+    fl.handle = handle;
+    fl.ret = 0;
+    ukvm_do_hypercall(UKVM_HYPERCALL_BLKFLUSH, &fl);
+
+    return fl.ret;
+}
+
+int solo5_blk_discard_h(int handle, uint64_t sec, uint64_t count)
+{
+    volatile struct ukvm_blkdiscard d;
+
+    d.handle = handle;
+    d.sector = sec;
+    d.nsectors = count;
+    d.ret = 0;
+    ukvm_do_hypercall(UKVM_HYPERCALL_BLKDISCARD, &d);
+
+    return d.ret;
+}
+
+int solo5_blk_write_zeroes_h(int handle, uint64_t sec, uint64_t count)
+{
+    volatile struct ukvm_blkwritezeroes wz;
+
+    wz.handle = handle;
+    wz.sector = sec;
+    wz.nsectors = count;
+    wz.ret = 0;
+    ukvm_do_hypercall(UKVM_HYPERCALL_BLKWRITEZEROES, &wz);
+
+    return wz.ret;
+}
+
+int solo5_blk_flush(void)
+{
+    return solo5_blk_flush_h(0);
+}
+
+int solo5_blk_discard(uint64_t sec, uint64_t count)
+{
+    return solo5_blk_discard_h(0, sec, count);
+}
+
+int solo5_blk_write_zeroes(uint64_t sec, uint64_t count)
+{
+    return solo5_blk_write_zeroes_h(0, sec, count);
+}
+
 int solo5_blk_sector_size(void)
 {
     volatile struct ukvm_blkinfo info;
 
+    info.handle = 0;
     ukvm_do_hypercall(UKVM_HYPERCALL_BLKINFO, &info);
 
     return info.sector_size;
@@ -63,6 +378,7 @@ uint64_t solo5_blk_sectors(void)
 {
     volatile struct ukvm_blkinfo info;
 
+    info.handle = 0;
     ukvm_do_hypercall(UKVM_HYPERCALL_BLKINFO, &info);
 
     return info.num_sectors;
@@ -72,7 +388,18 @@ int solo5_blk_rw(void)
 {
     volatile struct ukvm_blkinfo info;
 
+    info.handle = 0;
     ukvm_do_hypercall(UKVM_HYPERCALL_BLKINFO, &info);
 
     return info.rw;
 }
+
+const uint8_t *solo5_blk_map(void)
+{
+    return blkmap_get(0);
+}
+
+const uint8_t *solo5_blk_map_h(int handle)
+{
+    return blkmap_get(handle);
+}
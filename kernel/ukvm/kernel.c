@@ -22,6 +22,7 @@
 
 void _start(void *arg)
 {
+    volatile struct ukvm_snapshot snap;
     int ret;
     char *cmdline;
 
@@ -39,6 +40,15 @@ void _start(void *arg)
     time_init(arg);
     net_init();
 
+    /*
+     * With --snapshot, the monitor saves a snapshot of the guest here, from
+     * which later instances start with --restore.
+     */
+    snap.ret = 0;
+    ukvm_do_hypercall(UKVM_HYPERCALL_SNAPSHOT, &snap);
+    if (snap.ret == 1)
+        log(INFO, "Solo5: Restored from snapshot\n");
+
     ret = solo5_app_main(cmdline);
     log(DEBUG, "Solo5: solo5_app_main() returned with %d\n", ret);
 
@@ -27,6 +27,10 @@
 void time_init(struct ukvm_boot_info *bi);
 void console_init(void);
 void net_init(void);
+/* net.c: returns 1 if frames are pending on any shared-memory RX ring */
+int net_ring_pending(void);
+/* block.c: returns 1 if asynchronous block I/O completions are pending */
+int blk_ring_pending(void);
 
 /* tscclock.c: TSC-based clock */
 uint64_t tscclock_monotonic(void);
@@ -20,13 +20,224 @@
 
 #include "kernel.h"
 
-/* ukvm net interface */
-int solo5_net_write_sync(uint8_t *data, int n)
+static struct ukvm_netinfo netinfo;
+static int net_configured;
+
+/*
+ * Shared-memory rings, one pair per queue, if supported by the monitor
+ * (UKVM_NET_F_RINGS). (nrings) is 0 if rings are not in use.
+ */
+static struct ukvm_netring *ring_tx[UKVM_NET_QUEUES_MAX];
+static struct ukvm_netring *ring_rx[UKVM_NET_QUEUES_MAX];
+static unsigned nrings;
+/* Next RX ring to read from */
+static unsigned ring_rx_next;
+
+static void net_setup_rings(void)
+{
+    volatile struct ukvm_netrings r;
+    unsigned i, n = netinfo.nqueues;
+
+    assert(n >= 1 && n <= UKVM_NET_QUEUES_MAX);
+    for (i = 0; i < n; i++) {
+        ring_tx[i] = memalign(PAGE_SIZE, sizeof (struct ukvm_netring));
+        ring_rx[i] = memalign(PAGE_SIZE, sizeof (struct ukvm_netring));
+        if (ring_tx[i] == NULL || ring_rx[i] == NULL)
+            goto fail;
+        memset(ring_tx[i], 0, sizeof (struct ukvm_netring));
+        memset(ring_rx[i], 0, sizeof (struct ukvm_netring));
+    }
+
+    for (i = 0; i < n; i++) {
+        r.queue = i;
+        r.tx = ring_tx[i];
+        r.rx = ring_rx[i];
+        r.ret = -1;
+
+        ukvm_do_hypercall(UKVM_HYPERCALL_NETRINGS, &r);
+
+        /*
+         * Once the first queue is using rings, the monitor no longer accepts
+         * frames any other way, so failure on any other queue is fatal.
+         */
+        if (r.ret != 0) {
+            if (i == 0)
+                goto fail;
+            PANIC("Solo5: Net: Could not set up rings\n");
+        }
+    }
+    nrings = n;
+    log(INFO, "Solo5: Net: Using shared-memory rings (%u queues)\n", n);
+    return;
+
+fail:
+    log(WARN, "Solo5: Net: Could not set up rings\n");
+    for (i = 0; i < n; i++) {
+        free(ring_tx[i]);
+        free(ring_rx[i]);
+        ring_tx[i] = ring_rx[i] = NULL;
+    }
+}
+
+/*
+ * The network device may not be configured in the monitor, so it is only
+ * queried (and rings set up) on first use.
+ */
+static void net_configure(void)
+{
+    volatile struct ukvm_netinfo info;
+
+    if (net_configured)
+        return;
+    net_configured = 1;
+
+    ukvm_do_hypercall(UKVM_HYPERCALL_NETINFO, &info);
+    memcpy(&netinfo, (void *)&info, sizeof netinfo);
+
+    if (netinfo.features & UKVM_NET_F_RINGS)
+        net_setup_rings();
+}
+
+static void ring_kick(unsigned q)
+{
+    volatile struct ukvm_netkick k;
+
+    k.queue = q;
+    ukvm_do_hypercall(UKVM_HYPERCALL_NETKICK, &k);
+}
+
+static uint32_t fnv1a(uint32_t h, const uint8_t *p, int n)
+{
+    while (n--)
+        h = (h ^ *p++) * 16777619U;
+    return h;
+}
+
+/*
+ * Choose a TX queue for the frame (data) of size (n), such that all frames of
+ * a TCP or UDP flow over IPv4 or IPv6 are sent on the same queue. Frames of
+ * other protocols are sent on queue 0.
+ */
+static unsigned ring_flow_queue(const uint8_t *data, int n)
+{
+    uint32_t h = 2166136261U;
+    int proto, l4;
+
+    if (nrings == 1)
+        return 0;
+
+    if (n >= 34 && data[12] == 0x08 && data[13] == 0x00) {
+        /*
+         * IPv4: Only the first (or only) fragment of a datagram carries the
+         * ports, so ignore them for fragments.
+         */
+        h = fnv1a(h, &data[26], 8);
+        proto = data[23];
+        l4 = 14 + (data[14] & 0x0f) * 4;
+        if ((data[20] & 0x3f) != 0 || data[21] != 0)
+            proto = 0;
+    }
+    else if (n >= 54 && data[12] == 0x86 && data[13] == 0xdd) {
+        h = fnv1a(h, &data[22], 32);
+        proto = data[20];
+        l4 = 54;
+    }
+    else
+        return 0;
+
+    if ((proto == 6 || proto == 17) && n >= l4 + 4)
+        h = fnv1a(h, &data[l4], 4);
+    return h % nrings;
+}
+
+/*
+ * Produce a frame on TX ring (q). Returns 1 if the I/O thread may have seen
+ * the ring empty and must be kicked once the caller is done producing.
+ */
+static int ring_write(unsigned q, const uint8_t *data, int n)
+{
+    struct ukvm_netring *tx = ring_tx[q];
+    uint32_t prod = tx->prod;
+    struct ukvm_netring_slot *slot;
+
+    /*
+     * The I/O thread never sleeps while the TX ring is not empty, so if it is
+     * full space will become available shortly. Kicking while full blocks in
+     * the monitor until the I/O thread has made space, rather than spinning.
+     */
+    while (prod - __atomic_load_n(&tx->cons, __ATOMIC_ACQUIRE) ==
+            UKVM_NETRING_SLOTS)
+        ring_kick(q);
+
+    slot = &tx->slot[prod % UKVM_NETRING_SLOTS];
+    memcpy(slot->data, data, n);
+    slot->len = n;
+
+    __atomic_store_n(&tx->prod, prod + 1, __ATOMIC_RELEASE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    return __atomic_load_n(&tx->cons, __ATOMIC_ACQUIRE) == prod;
+}
+
+/*
+ * Consume a frame from the next non-empty RX ring, starting after the ring
+ * last read from so that no queue is starved. Returns -1 if all rings are
+ * empty.
+ */
+static int ring_read(uint8_t *data, int *n)
+{
+    struct ukvm_netring *rx = NULL;
+    struct ukvm_netring_slot *slot;
+    uint32_t cons = 0;
+    unsigned i, q = 0;
+    int len;
+
+    for (i = 0; i < nrings; i++) {
+        q = ring_rx_next;
+        ring_rx_next = (ring_rx_next + 1) % nrings;
+        cons = ring_rx[q]->cons;
+        if (__atomic_load_n(&ring_rx[q]->prod, __ATOMIC_ACQUIRE) != cons) {
+            rx = ring_rx[q];
+            break;
+        }
+    }
+    if (rx == NULL)
+        return -1;
+
+    slot = &rx->slot[cons % UKVM_NETRING_SLOTS];
+    len = slot->len;
+    if (len > *n)
+        len = *n;
+    memcpy(data, slot->data, len);
+    *n = len;
+
+    __atomic_store_n(&rx->cons, cons + 1, __ATOMIC_RELEASE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&rx->prod, __ATOMIC_ACQUIRE) - cons ==
+            UKVM_NETRING_SLOTS)
+        ring_kick(q);
+    return 0;
+}
+
+int net_ring_pending(void)
+{
+    unsigned i;
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    for (i = 0; i < nrings; i++) {
+        if (__atomic_load_n(&ring_rx[i]->prod, __ATOMIC_ACQUIRE) !=
+                ring_rx[i]->cons)
+            return 1;
+    }
+    return 0;
+}
+
+static int net_write(uint8_t *data, int n, const struct solo5_net_hdr *hdr)
 {
     volatile struct ukvm_netwrite wr;
 
     wr.data = data;
     wr.len = n;
+    wr.hdr = (const struct ukvm_net_hdr *)hdr;
     wr.ret = 0;
 
     ukvm_do_hypercall(UKVM_HYPERCALL_NETWRITE, &wr);
@@ -34,11 +245,12 @@ int solo5_net_write_sync(uint8_t *data, int n)
     return wr.ret;
 }
 
-int solo5_net_read_sync(uint8_t *data, int *n)
+static int net_read(uint8_t *data, int *n, struct solo5_net_hdr *hdr)
 {
     volatile struct ukvm_netread rd;
 
     rd.data = data;
+    rd.hdr = (struct ukvm_net_hdr *)hdr;
     rd.len = *n;
     rd.ret = 0;
 
@@ -48,15 +260,156 @@ int solo5_net_read_sync(uint8_t *data, int *n)
     return rd.ret;
 }
 
-static char mac_str[18];
-char *solo5_net_mac_str(void)
+/* ukvm net interface */
+int solo5_net_write_sync(uint8_t *data, int n)
 {
-    volatile struct ukvm_netinfo info;
+    net_configure();
+    if (nrings) {
+        unsigned q;
 
-    ukvm_do_hypercall(UKVM_HYPERCALL_NETINFO, &info);
+        if (n < 0 || n > UKVM_NETRING_FRAME_SIZE)
+            return -1;
+        q = ring_flow_queue(data, n);
+        if (ring_write(q, data, n))
+            ring_kick(q);
+        return 0;
+    }
+
+    return net_write(data, n, NULL);
+}
+
+int solo5_net_read_sync(uint8_t *data, int *n)
+{
+    net_configure();
+    if (nrings)
+        return ring_read(data, n);
+
+    return net_read(data, n, NULL);
+}
+
+unsigned solo5_net_offloads(void)
+{
+    unsigned offloads = 0;
+
+    net_configure();
+    if (netinfo.features & UKVM_NET_F_CSUM)
+        offloads |= SOLO5_NET_OFFLOAD_CSUM;
+    if (netinfo.features & UKVM_NET_F_TSO4)
+        offloads |= SOLO5_NET_OFFLOAD_TSO4;
+    if (netinfo.features & UKVM_NET_F_TSO6)
+        offloads |= SOLO5_NET_OFFLOAD_TSO6;
+    return offloads;
+}
+
+int solo5_net_write_offload(const struct solo5_net_hdr *hdr, uint8_t *data,
+        int n)
+{
+    if (solo5_net_offloads() == 0)
+        return -1;
+
+    return net_write(data, n, hdr);
+}
+
+int solo5_net_read_offload(struct solo5_net_hdr *hdr, uint8_t *data, int *n)
+{
+    if (solo5_net_offloads() == 0)
+        return -1;
+
+    return net_read(data, n, hdr);
+}
+
+int solo5_net_write_batch(struct solo5_net_frame *frames, int n)
+{
+    struct ukvm_netiov iov[UKVM_NETIOV_MAX];
+    volatile struct ukvm_netwritev wr;
+    int i, cnt, sent = 0;
+
+    net_configure();
+    if (nrings) {
+        unsigned kick = 0, q;
+
+        /*
+         * Kick each queue at most once per batch, after producing on it.
+         */
+        for (i = 0; i < n; i++) {
+            if (frames[i].len < 0 || frames[i].len > UKVM_NETRING_FRAME_SIZE)
+                break;
+            q = ring_flow_queue(frames[i].data, frames[i].len);
+            if (ring_write(q, frames[i].data, frames[i].len))
+                kick |= 1U << q;
+        }
+        for (q = 0; kick; q++, kick >>= 1) {
+            if (kick & 1)
+                ring_kick(q);
+        }
+        return i ? i : -1;
+    }
+
+    while (sent < n) {
+        cnt = n - sent;
+        if (cnt > UKVM_NETIOV_MAX)
+            cnt = UKVM_NETIOV_MAX;
+        for (i = 0; i < cnt; i++) {
+            iov[i].data = frames[sent + i].data;
+            iov[i].len = frames[sent + i].len;
+        }
+
+        wr.iov = iov;
+        wr.iovcnt = cnt;
+        wr.nframes = 0;
+        wr.ret = 0;
+
+        ukvm_do_hypercall(UKVM_HYPERCALL_NETWRITEV, &wr);
+
+        if (wr.ret != 0)
+            return sent ? sent : -1;
+        sent += wr.nframes;
+    }
+
+    return sent;
+}
+
+int solo5_net_read_batch(struct solo5_net_frame *frames, int n)
+{
+    struct ukvm_netiov iov[UKVM_NETIOV_MAX];
+    volatile struct ukvm_netreadv rd;
+    int i;
+
+    net_configure();
+    if (nrings) {
+        for (i = 0; i < n; i++) {
+            if (ring_read(frames[i].data, &frames[i].len) != 0)
+                break;
+        }
+        return i;
+    }
+
+    if (n > UKVM_NETIOV_MAX)
+        n = UKVM_NETIOV_MAX;
+    for (i = 0; i < n; i++) {
+        iov[i].data = frames[i].data;
+        iov[i].len = frames[i].len;
+    }
+
+    rd.iov = iov;
+    rd.iovcnt = n;
+    rd.nframes = 0;
+    rd.ret = 0;
+
+    ukvm_do_hypercall(UKVM_HYPERCALL_NETREADV, &rd);
+
+    if (rd.ret != 0)
+        return 0;
+    for (i = 0; i < (int)rd.nframes; i++)
+        frames[i].len = iov[i].len;
+    return rd.nframes;
+}
+
+char *solo5_net_mac_str(void)
+{
+    net_configure();
 
-    memcpy(mac_str, (void *)&info, 18);
-    return mac_str;
+    return netinfo.mac_str;
 }
 
 void net_init(void)
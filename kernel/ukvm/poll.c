@@ -25,6 +25,13 @@ int solo5_poll(uint64_t until_nsecs)
     struct ukvm_poll t;
     uint64_t now;
 
+    /*
+     * Frames received via the shared-memory rings and block I/O completions
+     * do not need an exit.
+     */
+    if (net_ring_pending() || blk_ring_pending())
+        return 1;
+
     now = solo5_clock_monotonic();
     if (until_nsecs <= now)
         t.timeout_nsecs = 0;
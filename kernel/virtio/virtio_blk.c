@@ -204,6 +204,78 @@ int solo5_blk_read_sync(uint64_t sector, uint8_t *data, int *n)
     return virtio_blk_op_sync(VIRTIO_BLK_T_IN, sector, data, n);
 }
 
+int solo5_blk_writev(struct solo5_blk_seg *segs, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if (solo5_blk_write_sync(segs[i].sector, segs[i].data,
+                    segs[i].len) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+int solo5_blk_readv(struct solo5_blk_seg *segs, int n)
+{
+    int i, len;
+
+    for (i = 0; i < n; i++) {
+        len = segs[i].len;
+        if (solo5_blk_read_sync(segs[i].sector, segs[i].data, &len) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+int solo5_blk_submit(const struct solo5_blk_req *reqs __attribute__((unused)),
+                     int n __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_blk_reap(struct solo5_blk_completion *c __attribute__((unused)),
+                   int n __attribute__((unused)))
+{
+    return 0;
+}
+
+int solo5_blk_flush(void)
+{
+    assert(blk_configured);
+    /*
+     * No features are negotiated, in particular not VIRTIO_BLK_F_FLUSH, so
+     * the device operates in write-through mode and there is nothing to
+     * flush.
+     */
+    return 0;
+}
+
+int solo5_blk_discard(uint64_t sec, uint64_t count)
+{
+    assert(blk_configured);
+    /*
+     * VIRTIO_BLK_F_DISCARD is not negotiated, and discard is only a hint.
+     */
+    if (sec > virtio_blk_sectors || count > virtio_blk_sectors - sec)
+        return -1;
+    return 0;
+}
+
+int solo5_blk_write_zeroes(uint64_t sec, uint64_t count)
+{
+    static uint8_t zeroes[VIRTIO_BLK_SECTOR_SIZE];
+
+    assert(blk_configured);
+    if (sec > virtio_blk_sectors || count > virtio_blk_sectors - sec)
+        return -1;
+    for (; count > 0; sec++, count--) {
+        if (solo5_blk_write_sync(sec, zeroes, sizeof zeroes) != 0)
+            return -1;
+    }
+    return 0;
+}
+
 int solo5_blk_sector_size(void)
 {
     assert(blk_configured);
@@ -224,3 +296,84 @@ int solo5_blk_rw(void)
 
     return 1;
 }
+
+const uint8_t *solo5_blk_map(void)
+{
+    return NULL;
+}
+
+/*
+ * Only a single block device is supported, which has the empty name.
+ */
+int solo5_blk_open(const char *name)
+{
+    assert(blk_configured);
+
+    return name[0] == '\0' ? 0 : -1;
+}
+
+int solo5_blk_info(int handle, struct solo5_blk_info *info)
+{
+    assert(blk_configured);
+    if (handle != 0)
+        return -1;
+
+    info->sector_size = VIRTIO_BLK_SECTOR_SIZE;
+    info->sectors = virtio_blk_sectors;
+    info->rw = 1;
+    return 0;
+}
+
+int solo5_blk_write(int handle, uint64_t sec, const uint8_t *data, int n)
+{
+    if (handle != 0)
+        return -1;
+    return solo5_blk_write_sync(sec, (uint8_t *)data, n);
+}
+
+int solo5_blk_read(int handle, uint64_t sec, uint8_t *data, int n)
+{
+    if (handle != 0)
+        return -1;
+    return solo5_blk_read_sync(sec, data, &n);
+}
+
+int solo5_blk_writev_h(int handle, struct solo5_blk_seg *segs, int n)
+{
+    if (handle != 0)
+        return -1;
+    return solo5_blk_writev(segs, n);
+}
+
+int solo5_blk_readv_h(int handle, struct solo5_blk_seg *segs, int n)
+{
+    if (handle != 0)
+        return -1;
+    return solo5_blk_readv(segs, n);
+}
+
+int solo5_blk_flush_h(int handle)
+{
+    if (handle != 0)
+        return -1;
+    return solo5_blk_flush();
+}
+
+int solo5_blk_discard_h(int handle, uint64_t sec, uint64_t count)
+{
+    if (handle != 0)
+        return -1;
+    return solo5_blk_discard(sec, count);
+}
+
+int solo5_blk_write_zeroes_h(int handle, uint64_t sec, uint64_t count)
+{
+    if (handle != 0)
+        return -1;
+    return solo5_blk_write_zeroes(sec, count);
+}
+
+const uint8_t *solo5_blk_map_h(int handle __attribute__((unused)))
+{
+    return NULL;
+}
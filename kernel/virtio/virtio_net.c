@@ -306,6 +306,55 @@ int solo5_net_read_sync(uint8_t *data, int *n)
     return 0;
 }
 
+/*
+ * XXX: The virtio queues are driven one packet at a time, so there is no
+ * benefit to batching here; these are provided for API compatibility.
+ */
+int solo5_net_write_batch(struct solo5_net_frame *frames, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if (solo5_net_write_sync(frames[i].data, frames[i].len) != 0)
+            return i ? i : -1;
+    }
+    return n;
+}
+
+int solo5_net_read_batch(struct solo5_net_frame *frames, int n)
+{
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if (solo5_net_read_sync(frames[i].data, &frames[i].len) != 0)
+            break;
+    }
+    return i;
+}
+
+/*
+ * Offloads are not negotiated with the device.
+ */
+unsigned solo5_net_offloads(void)
+{
+    return 0;
+}
+
+int solo5_net_write_offload(const struct solo5_net_hdr *hdr
+                                __attribute__((unused)),
+                            uint8_t *data __attribute__((unused)),
+                            int n __attribute__((unused)))
+{
+    return -1;
+}
+
+int solo5_net_read_offload(struct solo5_net_hdr *hdr __attribute__((unused)),
+                           uint8_t *data __attribute__((unused)),
+                           int *n __attribute__((unused)))
+{
+    return -1;
+}
+
 char *solo5_net_mac_str(void)
 {
     assert(net_configured);
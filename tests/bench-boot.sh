@@ -0,0 +1,100 @@
+#!/bin/sh
+# Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+#
+# This file is part of Solo5, a unikernel base layer.
+#
+# Permission to use, copy, modify, and/or distribute this software
+# for any purpose with or without fee is hereby granted, provided
+# that the above copyright notice and this permission notice appear
+# in all copies.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+# WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+# WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+# AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+# CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+# OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+# NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+# CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#
+# Compare the latency of booting a unikernel with that of restoring it from a
+# snapshot (ukvm --snapshot / --restore), and of starting it from a zygote
+# (ukvm --zygote) with and without a snapshot.
+#
+# Usage: bench-boot.sh [ UNIKERNEL [ RUNS ] ]
+#
+# UNIKERNEL defaults to test_hello.ukvm, which must have been built. Reports the
+# average wall clock time per run, from starting ukvm-bin (or ukvm-launch) to
+# its exit, and for zygotes the rate at which a burst of RUNS instances is
+# started.
+
+die ()
+{
+    echo $0: "$@" 1>&2
+    exit 1
+}
+
+SCRIPT_DIR=$(cd $(dirname $0) && pwd)
+UNIKERNEL=${1:-${SCRIPT_DIR}/test_hello/test_hello.ukvm}
+RUNS=${2:-100}
+UKVM=$(dirname ${UNIKERNEL})/ukvm-bin
+[ -x ${UNIKERNEL} ] || die "Not found: ${UNIKERNEL}"
+[ -x ${UKVM} ] || die "Not found: ${UKVM}"
+
+LAUNCH=${SCRIPT_DIR}/../ukvm/ukvm-launch
+[ -x ${LAUNCH} ] || die "Not found: ${LAUNCH}"
+
+TMPDIR=$(mktemp -d) || die "error creating temporary directory"
+SNAPSHOT=${TMPDIR}/snapshot
+PIDS=
+trap '[ -n "${PIDS}" ] && kill ${PIDS}; rm -rf ${TMPDIR}' 0 INT TERM
+
+# Prints the average time in microseconds taken by RUNS runs of "$@".
+bench ()
+{
+    local START END I
+
+    START=$(date +%s%N)
+    I=0
+    while [ ${I} -lt ${RUNS} ]; do
+        "$@" >/dev/null 2>&1 || die "Failed: $*"
+        I=$((I + 1))
+    done
+    END=$(date +%s%N)
+    echo $(( (END - START) / RUNS / 1000 ))
+}
+
+${UKVM} --snapshot=${SNAPSHOT} -- ${UNIKERNEL} >/dev/null ||
+    die "Could not take snapshot"
+# Warm the host page cache for both.
+${UKVM} -- ${UNIKERNEL} >/dev/null 2>&1
+${UKVM} --restore=${SNAPSHOT} >/dev/null 2>&1
+
+# Starts a zygote on socket $1 with the remaining arguments.
+zygote ()
+{
+    local SOCKET=$1
+
+    shift
+    ${UKVM} --zygote=${SOCKET} "$@" 2>/dev/null &
+    PIDS="${PIDS} $!"
+    while [ ! -S ${SOCKET} ]; do
+        sleep 0.1
+    done
+}
+
+zygote ${TMPDIR}/zygote -- ${UNIKERNEL}
+zygote ${TMPDIR}/zygote-restore --restore=${SNAPSHOT}
+
+echo "cold boot       : $(bench ${UKVM} -- ${UNIKERNEL}) us/run (${RUNS} runs)"
+echo "restore         : $(bench ${UKVM} --restore=${SNAPSHOT}) us/run" \
+    "(${RUNS} runs)"
+echo "zygote          : $(bench ${LAUNCH} ${TMPDIR}/zygote) us/run" \
+    "(${RUNS} runs)"
+echo "zygote + restore: $(bench ${LAUNCH} ${TMPDIR}/zygote-restore) us/run" \
+    "(${RUNS} runs)"
+printf "zygote burst          : "
+${LAUNCH} -n ${RUNS} ${TMPDIR}/zygote 2>&1 >/dev/null
+printf "zygote + restore burst: "
+${LAUNCH} -n ${RUNS} ${TMPDIR}/zygote-restore 2>&1 >/dev/null
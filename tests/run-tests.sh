@@ -60,24 +60,35 @@ run_test ()
 {
     logto ()
     {
-        LOG=${TMPDIR}/$1
+        LOG=${LOGDIR}/$1
         exec >>${LOG} 2>&1 </dev/null
     }
 
     local ARGS
     local DISK
+    local DISK_OPTS
+    local DISK2
     local NET
+    local RESTORE
+    local ZYGOTE
+    local MEM_OPTS
     local WANT_ABORT
     local NAME
     local UNIKERNEL
     local TEST_DIR
     local STATUS
 
-    ARGS=$(getopt dnav $*)
+    ARGS=$(getopt dDSomrsRZHLnbpPav $*)
     [ $? -ne 0 ] && die "Invalid test options"
     set -- ${ARGS}
     DISK=
+    DISK_OPTS=
+    DISK2=
     NET=
+    PING=
+    RESTORE=
+    ZYGOTE=
+    MEM_OPTS=
     WANT_ABORT=
     WANT_QUIET=
     while true; do
@@ -86,9 +97,83 @@ run_test ()
             DISK=${TMPDIR}/disk.img
             shift
             ;;
+        -D)
+            # Block device test using O_DIRECT (ukvm only)
+            DISK=${TMPDIR}/disk.img
+            DISK_OPTS=--disk-direct
+            shift
+            ;;
+        -S)
+            # Block device test with 4096 byte sectors (ukvm only)
+            DISK=${TMPDIR}/disk.img
+            DISK_OPTS=--disk-sector-size=4096
+            shift
+            ;;
+        -m)
+            # Block device test with the disk mapped into the guest (ukvm
+            # only)
+            DISK=${TMPDIR}/disk.img
+            DISK_OPTS=--disk-map
+            shift
+            ;;
+        -r)
+            # Block device test using a 4MB ram disk (ukvm only)
+            DISK=ram:4
+            shift
+            ;;
+        -s)
+            # Block device test with a second, named disk (ukvm only)
+            DISK=${TMPDIR}/disk.img
+            DISK2=${TMPDIR}/disk2.img
+            DISK_OPTS=--disk=second:${DISK2}
+            shift
+            ;;
+        -o)
+            # Block device test using a copy-on-write overlay (ukvm only)
+            DISK=${TMPDIR}/delta.img
+            DISK_OPTS=--disk-base=${TMPDIR}/disk.img
+            shift
+            ;;
+        -R)
+            # Run from a snapshot taken before solo5_app_main() (ukvm only)
+            RESTORE=true
+            shift
+            ;;
+        -Z)
+            # Start the test from a zygote, passing module options with the
+            # launch request (ukvm only)
+            ZYGOTE=true
+            shift
+            ;;
+        -H)
+            # Back guest memory with huge pages if available (ukvm only)
+            MEM_OPTS=--mem-hugepages=auto
+            shift
+            ;;
+        -L)
+            # Run with more than 4GB of guest memory (ukvm only)
+            MEM_OPTS=--mem=6144
+            shift
+            ;;
         -n)
             NET=tap100
             NET_IP=10.0.0.2
+            PING=true
+            shift
+            ;;
+        -b)
+            # Network benchmark, needs the tap interface but no ping client
+            NET=tap100
+            shift
+            ;;
+        -p)
+            # Network benchmark over AF_PACKET, needs the veth interface
+            NET=packet:veth100
+            shift
+            ;;
+        -P)
+            # Network benchmark receiving a looped capture (ukvm only)
+            NET=replay:${SCRIPT_DIR}/test_net_bench/replay.pcap,loop
             shift
             ;;
         -a)
@@ -119,16 +204,23 @@ run_test ()
         (
             logto ${NAME}.log.1
             set -x; dd if=/dev/zero of=${TMPDIR}/disk.img bs=4k count=1024
+            rm -f ${TMPDIR}/delta.img
+            [ -n "${DISK2}" ] && dd if=/dev/zero of=${DISK2} bs=4k count=16
         )
     fi
 
     # Network test. Run flood ping as the "client".
     # XXX This is pretty hacky, and needs improvement. Should also check for
     # no packet loss on the ping side.
-    if [ -n "${NET}" ]; then
-        # Need root to run this test (for ping -f)
+    case ${NET} in
+    ""|replay:*)
+        ;;
+    *)
+        # Need root to run this test (for ping -f and access to the tap)
         [ $(id -u) -ne 0 ] && return 98
-        NET=tap100
+        ;;
+    esac
+    if [ -n "${PING}" ]; then
         (
             logto ${NAME}.log.2
             sleep 1
@@ -157,11 +249,33 @@ run_test ()
                     die "Don't know how to run ${NAME} on ${OS}"
                     ;;
             esac
-            UKVM=${TEST_DIR}/ukvm-bin
-            [ -n "${DISK}" ] && UKVM="${UKVM} --disk=${DISK}"
+            UKVM="${TEST_DIR}/ukvm-bin ${MEM_OPTS}"
+            if [ -n "${ZYGOTE}" ]; then
+                LAUNCH=${SCRIPT_DIR}/../ukvm/ukvm-launch
+                [ -x ${LAUNCH} ] || exit 98
+                SOCKET=${LOGDIR}/${NAME}.sock
+                ${UKVM} --zygote=${SOCKET} -- ${UNIKERNEL} &
+                PID_ZYGOTE=$!
+                while [ ! -S ${SOCKET} ]; do
+                    kill -0 ${PID_ZYGOTE} 2>/dev/null || exit 1
+                    sleep 0.1
+                done
+                UKVM="${LAUNCH} ${SOCKET}"
+            fi
+            [ -n "${DISK}" ] && UKVM="${UKVM} --disk=${DISK} ${DISK_OPTS}"
             [ -n "${NET}" ] && UKVM="${UKVM} --net=${NET}"
-            (set -x; timeout 30s ${UKVM} -- ${UNIKERNEL} "$@")
+            if [ -n "${ZYGOTE}" ]; then
+                (set -x; timeout 30s ${UKVM} -- "$@")
+            elif [ -n "${RESTORE}" ]; then
+                SNAPSHOT=${LOGDIR}/${NAME}.snap
+                (set -x; timeout 30s ${UKVM} --snapshot=${SNAPSHOT} -- \
+                    ${UNIKERNEL} "$@") &&
+                (set -x; timeout 30s ${UKVM} --restore=${SNAPSHOT})
+            else
+                (set -x; timeout 30s ${UKVM} -- ${UNIKERNEL} "$@")
+            fi
             STATUS=$?
+            [ -n "${ZYGOTE}" ] && kill ${PID_ZYGOTE}
             ;;
         *.virtio)
             VIRTIO=${SCRIPT_DIR}/../tools/run/solo5-run-virtio.sh
@@ -180,7 +294,7 @@ run_test ()
     case ${STATUS} in
     # XXX Should this be abstracted out in solo5-run-virtio.sh?
     0|2|83) 
-        LOGS=$(find ${TMPDIR} -type f -name ${NAME}.log.\*)
+        LOGS=$(find ${LOGDIR} -type f -name ${NAME}.log.\*)
 
         STATUS=99
         if [ -z "${WANT_ABORT}" ]; then
@@ -209,7 +323,7 @@ run_test ()
 
 dumplogs ()
 {
-    LOGS=$(find ${TMPDIR} -type f -name $1.log.\*)
+    LOGS=$(find ${LOGDIR} -type f -name $1.log.\*)
     for F in ${LOGS}; do
         echo "$2${F}: $3"
         cat ${F} | sed "s/^/$2>$3 /"
@@ -269,8 +383,31 @@ if [ "${BUILD_UKVM}" = "yes" ]; then
     add_test test_exception.ukvm/-a
     add_test test_fpu.ukvm
     add_test test_time.ukvm
+    add_test test_hello.ukvm/-R/Hello_Solo5
+    add_test test_time.ukvm/-R
+    add_test test_hello.ukvm/-Z/Hello_Solo5
+    add_test test_hello.ukvm/-H/Hello_Solo5
+    add_test test_hello.ukvm/-L/Hello_Solo5
     add_test test_blk.ukvm/-d
+    add_test test_blk.ukvm/-D
+    add_test test_blk.ukvm/-S
+    add_test test_blk.ukvm/-o
+    add_test test_blk.ukvm/-m
+    add_test test_blk.ukvm/-s
+    add_test test_blk.ukvm/-r
+    add_test test_blk.ukvm/-dR
+    add_test test_blk.ukvm/-dZ
+    add_test test_blk.ukvm/-dL
     add_test test_ping_serve.ukvm/-n/limit
+    add_test test_net_bench.ukvm/-b
+    [ "$(uname -s)" = "Linux" ] && add_test test_net_bench.ukvm/-p
+    add_test test_net_bench.ukvm/-P/rx
+    add_test test_blk_bench.ukvm/-d
+    add_test test_blk_bench.ukvm/-o
+    add_test test_blk_bench.ukvm/-S
+    add_test test_blk_bench.ukvm/-r
+    add_test test_mem_bench.ukvm
+    add_test test_mem_bench.ukvm/-H
 fi
 if [ "${BUILD_VIRTIO}" = "yes" ]; then
     add_test test_hello.virtio//Hello_Solo5
@@ -281,6 +418,8 @@ if [ "${BUILD_VIRTIO}" = "yes" ]; then
     add_test test_time.virtio
     add_test test_blk.virtio/-d
     add_test test_ping_serve.virtio/-n/limit
+    add_test test_net_bench.virtio/-b
+    add_test test_blk_bench.virtio/-d
 fi
 # No tests for BUILD_MUEN (yet).
 
@@ -289,6 +428,7 @@ echo "Starting tests at $(date)"
 
 FAILED=
 SKIPPED=
+RUN=0
 for T in ${TESTS}; do
     OLDIFS=$IFS
     IFS=/
@@ -301,6 +441,11 @@ for T in ${TESTS}; do
     else
         OPTS=
     fi
+    # Each run of a test logs to its own directory, so that variants of the
+    # same test never see each other's logs.
+    RUN=$((RUN + 1))
+    LOGDIR=${TMPDIR}/log.${RUN}
+    mkdir ${LOGDIR} || die "error creating log directory"
     printf "%-32s: " "${NAME}"
     run_test ${OPTS} -- ${NAME} "$@"
     case $? in
@@ -21,6 +21,9 @@
 # Set up test environment.
 #
 # Convention is: tap interface named 'tap100', host address of 10.0.0.1/24.
+# On Linux, also a veth pair 'veth100' (used by the guest via AF_PACKET) and
+# 'veth101', the latter in network namespace 'solo5-test' with an address of
+# 10.0.1.1/24.
 #
 
 if [ $(id -u) -ne 0 ]; then
@@ -34,6 +37,12 @@ Linux)
     ip tuntap add tap100 mode tap
     ip addr add 10.0.0.1/24 dev tap100
     ip link set dev tap100 up
+    ip netns add solo5-test
+    ip link add veth100 type veth peer name veth101
+    ip link set veth101 netns solo5-test
+    ip link set dev veth100 up
+    ip netns exec solo5-test ip addr add 10.0.1.1/24 dev veth101
+    ip netns exec solo5-test ip link set dev veth101 up
     ;;
 FreeBSD)
     kldload vmm
@@ -26,31 +26,32 @@ static void puts(const char *s)
     solo5_console_write(s, strlen(s));
 }
 
-#define SECTOR_SIZE	512
+#define SECTOR_SIZE_MAX 4096
+static int sector_size;
 
 /* Space for 2 sectors for edge-case tests */
-static uint8_t wbuf[SECTOR_SIZE * 2];
-static uint8_t rbuf[SECTOR_SIZE * 2];
+static uint8_t wbuf[SECTOR_SIZE_MAX * 2];
+static uint8_t rbuf[SECTOR_SIZE_MAX * 2];
 
 int check_sector_write(uint64_t sector)
 {
-    int rlen = SECTOR_SIZE;
-    unsigned i;
+    int rlen = sector_size;
+    int i;
 
-    for (i = 0; i < SECTOR_SIZE; i++) {
+    for (i = 0; i < sector_size; i++) {
         wbuf[i] = '0' + i % 10;
         rbuf[i] = 0;
     }
 
-    if (solo5_blk_write_sync(sector, wbuf, SECTOR_SIZE) != 0)
+    if (solo5_blk_write_sync(sector, wbuf, sector_size) != 0)
         return 1;
     if (solo5_blk_read_sync(sector, rbuf, &rlen) != 0)
         return 1;
 
-    if (rlen != SECTOR_SIZE)
+    if (rlen != sector_size)
         return 1;
     
-    for (i = 0; i < SECTOR_SIZE; i++) {
+    for (i = 0; i < sector_size; i++) {
         if (rbuf[i] != '0' + i % 10)
             /* Check failed */
             return 1;
@@ -59,8 +60,241 @@ int check_sector_write(uint64_t sector)
     return 0;
 }
 
+/*
+ * Write two adjacent sectors and a third distant one on disk (h) in a single
+ * call, then read them back in a different order.
+ */
+int check_vectored(int h, uint64_t sector)
+{
+    struct solo5_blk_seg segs[3];
+    int i;
+
+    for (i = 0; i < sector_size * 2; i++) {
+        wbuf[i] = 'a' + i % 26;
+        rbuf[i] = 0;
+    }
+
+    segs[0].sector = sector;
+    segs[0].data = &wbuf[0];
+    segs[0].len = sector_size;
+    segs[1].sector = sector + 1;
+    segs[1].data = &wbuf[sector_size];
+    segs[1].len = sector_size;
+    segs[2].sector = sector + 5;
+    segs[2].data = &wbuf[1];                /* Unaligned buffer */
+    segs[2].len = sector_size;
+    if (solo5_blk_writev_h(h, segs, 3) != 0)
+        return 1;
+
+    segs[0].sector = sector + 1;
+    segs[0].data = &rbuf[sector_size];
+    segs[1].sector = sector;
+    segs[1].data = &rbuf[0];
+    if (solo5_blk_readv_h(h, segs, 2) != 0)
+        return 1;
+    for (i = 0; i < sector_size * 2; i++) {
+        if (rbuf[i] != 'a' + i % 26)
+            return 1;
+    }
+
+    segs[0].sector = sector + 5;
+    segs[0].data = &rbuf[0];
+    if (solo5_blk_readv_h(h, segs, 1) != 0)
+        return 1;
+    for (i = 0; i < sector_size; i++) {
+        if (rbuf[i] != 'a' + (i + 1) % 26)
+            return 1;
+    }
+
+    return 0;
+}
+
+#define NASYNC 32
+/* Aligned, so that --disk-direct can do these without bouncing */
+static uint8_t abuf[NASYNC][SECTOR_SIZE_MAX] __attribute__((aligned(4096)));
+
+/*
+ * Wait for (n) asynchronous requests to complete successfully, checking that
+ * each of the ids 0 .. (n - 1) completes exactly once.
+ */
+int wait_async(int n)
+{
+    struct solo5_blk_completion c[NASYNC];
+    uint8_t seen[NASYNC];
+    int i, rc, done = 0;
+
+    memset(seen, 0, sizeof seen);
+    while (done < n) {
+        solo5_poll(solo5_clock_monotonic() + 1000000000ULL);
+        rc = solo5_blk_reap(c, NASYNC);
+        for (i = 0; i < rc; i++) {
+            if (c[i].ret != 0 || c[i].id >= (uint64_t)n || seen[c[i].id])
+                return 1;
+            seen[c[i].id] = 1;
+        }
+        done += rc;
+    }
+    return 0;
+}
+
+/*
+ * Write NASYNC sectors with one asynchronous submission, then read them back
+ * the same way. Returns -1 if asynchronous I/O is not supported.
+ */
+int check_async(uint64_t sector)
+{
+    struct solo5_blk_req reqs[NASYNC];
+    int i, j;
+
+    for (i = 0; i < NASYNC; i++) {
+        for (j = 0; j < sector_size; j++)
+            abuf[i][j] = i + j;
+        reqs[i].id = i;
+        reqs[i].handle = 0;
+        reqs[i].op = SOLO5_BLK_OP_WRITE;
+        reqs[i].sector = sector + i;
+        reqs[i].data = abuf[i];
+        reqs[i].len = sector_size;
+    }
+    i = solo5_blk_submit(reqs, NASYNC);
+    if (i == -1)
+        return -1;
+    if (i != NASYNC || wait_async(NASYNC))
+        return 1;
+
+    memset(abuf, 0, sizeof abuf);
+    for (i = 0; i < NASYNC; i++)
+        reqs[i].op = SOLO5_BLK_OP_READ;
+    if (solo5_blk_submit(reqs, NASYNC) != NASYNC || wait_async(NASYNC))
+        return 1;
+    for (i = 0; i < NASYNC; i++) {
+        for (j = 0; j < sector_size; j++) {
+            if (abuf[i][j] != (uint8_t)(i + j))
+                return 1;
+        }
+    }
+
+    /*
+     * Flush the writes above.
+     */
+    reqs[0].op = SOLO5_BLK_OP_FLUSH;
+    if (solo5_blk_submit(reqs, 1) != 1 || wait_async(1))
+        return 1;
+
+    /*
+     * A request beyond the end of the device completes with an error.
+     */
+    reqs[0].op = SOLO5_BLK_OP_READ;
+    reqs[0].sector = solo5_blk_sectors();
+    if (solo5_blk_submit(reqs, 1) != 1 || wait_async(1) == 0)
+        return 1;
+    return 0;
+}
+
+/*
+ * Write a pattern to 4 sectors of disk (h), which has (nsectors) sectors,
+ * zero the middle 2 and check the result. Then discard them, which must not
+ * fail.
+ */
+int check_zeroes(int h, uint64_t nsectors, uint64_t sector)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        memset(wbuf, 'z', sector_size);
+        if (solo5_blk_write(h, sector + i, wbuf, sector_size) != 0)
+            return 1;
+    }
+    if (solo5_blk_write_zeroes_h(h, sector + 1, 2) != 0)
+        return 1;
+    for (i = 0; i < 4; i++) {
+        if (solo5_blk_read(h, sector + i, rbuf, sector_size) != 0)
+            return 1;
+        if (rbuf[0] != ((i == 1 || i == 2) ? 0 : 'z') ||
+                rbuf[sector_size - 1] != rbuf[0])
+            return 1;
+    }
+
+    if (solo5_blk_discard_h(h, sector, 4) != 0)
+        return 1;
+    if (solo5_blk_write_zeroes_h(h, nsectors, 1) != -1)
+        return 1;
+    return 0;
+}
+
+/*
+ * Check block device handles. If a second disk named "second" is present,
+ * check that it is independent of the default one.
+ */
+int check_handles(void)
+{
+    struct solo5_blk_info info;
+    struct solo5_blk_req req;
+    int h, i;
+
+    if (solo5_blk_open("") != 0 || solo5_blk_open("nonexistent") != -1)
+        return 1;
+    if (solo5_blk_info(0, &info) != 0 ||
+            info.sectors != solo5_blk_sectors() || info.rw != solo5_blk_rw())
+        return 1;
+    if (solo5_blk_info(-1, &info) != -1)
+        return 1;
+
+    h = solo5_blk_open("second");
+    if (h == -1)
+        return 0;
+    if (h == 0 || solo5_blk_info(h, &info) != 0 ||
+            info.sectors == solo5_blk_sectors())
+        return 1;
+
+    memset(wbuf, 'd', sector_size);
+    if (solo5_blk_write(0, 0, wbuf, sector_size) != 0)
+        return 1;
+    memset(wbuf, 's', sector_size);
+    if (solo5_blk_write(h, 0, wbuf, sector_size) != 0)
+        return 1;
+    if (solo5_blk_read(0, 0, rbuf, sector_size) != 0 || rbuf[0] != 'd')
+        return 1;
+    if (solo5_blk_read(h, 0, rbuf, sector_size) != 0)
+        return 1;
+    for (i = 0; i < sector_size; i++) {
+        if (rbuf[i] != 's')
+            return 1;
+    }
+    if (solo5_blk_read(h, info.sectors, rbuf, sector_size) != -1)
+        return 1;
+
+    /*
+     * Vectored I/O, write-zeroes, discard and flush on the second disk.
+     */
+    if (check_vectored(h, 8) || check_zeroes(h, info.sectors, 32) ||
+            solo5_blk_flush_h(h) != 0)
+        return 1;
+    if (solo5_blk_read(0, 0, rbuf, sector_size) != 0 || rbuf[0] != 'd')
+        return 1;
+    if (solo5_blk_flush_h(-1) != -1)
+        return 1;
+
+    /*
+     * Asynchronous requests are directed by their handle.
+     */
+    req.id = 0;
+    req.handle = h;
+    req.op = SOLO5_BLK_OP_READ;
+    req.sector = 0;
+    req.data = abuf[0];
+    req.len = sector_size;
+    i = solo5_blk_submit(&req, 1);
+    if (i == -1)
+        return 0;
+    if (i != 1 || wait_async(1) || abuf[0][0] != 's')
+        return 1;
+    return 0;
+}
+
 int solo5_app_main(char *cmdline __attribute__((unused)))
 {
+    struct solo5_blk_seg seg;
     size_t i, nsectors;
     int rlen;
 
@@ -70,6 +304,9 @@ int solo5_app_main(char *cmdline __attribute__((unused)))
      * Write and read/check one tenth of the disk.
      */
     nsectors = solo5_blk_sectors();
+    sector_size = solo5_blk_sector_size();
+    if (sector_size > SECTOR_SIZE_MAX)
+        return 1;
     for (i = 0; i <= nsectors; i += 10) {
         if (check_sector_write(i))
             /* Check failed */
@@ -79,12 +316,12 @@ int solo5_app_main(char *cmdline __attribute__((unused)))
     /*
      * Check edge case: read/write of last sector on the device.
      */
-    if (solo5_blk_write_sync(nsectors - 1, wbuf, SECTOR_SIZE) != 0)
+    if (solo5_blk_write_sync(nsectors - 1, wbuf, sector_size) != 0)
         return 2;
-    rlen = SECTOR_SIZE;
+    rlen = sector_size;
     if (solo5_blk_read_sync(nsectors - 1, rbuf, &rlen) != 0)
         return 3;
-    if (rlen != SECTOR_SIZE)
+    if (rlen != sector_size)
         return 4;
 
     /*
@@ -94,12 +331,33 @@ int solo5_app_main(char *cmdline __attribute__((unused)))
      * XXX Multi-sector block operations currently work only on ukvm, virtio
      * will always return -1 here.
      */
-    if (solo5_blk_write_sync(nsectors - 1, wbuf, 2 * SECTOR_SIZE) != -1)
+    if (solo5_blk_write_sync(nsectors - 1, wbuf, 2 * sector_size) != -1)
         return 5;
-    rlen = 2 * SECTOR_SIZE;
+    rlen = 2 * sector_size;
     if (solo5_blk_read_sync(nsectors - 1, rbuf, &rlen) != -1)
         return 6;
 
+    /*
+     * Check scatter-gather I/O, and that a segment beyond the end of the
+     * device fails the request.
+     */
+    if (check_vectored(0, 0))
+        return 7;
+    seg.sector = nsectors;
+    seg.data = rbuf;
+    seg.len = sector_size;
+    if (solo5_blk_readv(&seg, 1) != -1)
+        return 8;
+
+    if (check_async(0) == 1)
+        return 9;
+    if (solo5_blk_flush() != 0)
+        return 10;
+    if (check_zeroes(0, nsectors, 100))
+        return 11;
+    if (check_handles())
+        return 12;
+
     puts("SUCCESS\n");
 
     return 0;
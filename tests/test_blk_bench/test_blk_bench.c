@@ -0,0 +1,200 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a unikernel base layer.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../kernel/lib.c"
+
+static void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+static void putu(uint64_t n)
+{
+    char buf[21];
+    char *p = &buf[sizeof buf - 1];
+
+    *p = 0;
+    do {
+        *--p = '0' + (n % 10);
+        n /= 10;
+    } while (n);
+    puts(p);
+}
+
+#define NSEC_PER_SEC 1000000000ULL
+
+#define IO_SIZE     (64 * 1024)
+#define PASSES      8
+#define RAND_SIZE   4096
+#define NRAND       20000
+
+static uint8_t buf[IO_SIZE] __attribute__((aligned(4096)));
+static uint64_t sectors;
+static int sector_size, io_size;
+
+/*
+ * Prints a result line of the form:
+ *     NAME: OPS ops, KBPS kB/s, IOPS iops
+ */
+static void report(const char *name, uint64_t ops, uint64_t bytes,
+        uint64_t nsecs)
+{
+    puts(name);
+    puts(": ");
+    putu(ops);
+    puts(" ops, ");
+    putu(nsecs ? (bytes * NSEC_PER_SEC) / nsecs / 1024 : 0);
+    puts(" kB/s, ");
+    putu(nsecs ? (ops * NSEC_PER_SEC) / nsecs : 0);
+    puts(" iops\n");
+}
+
+/*
+ * Sequentially write or read the whole disk (passes) times in io_size
+ * requests.
+ */
+static int bench_seq(const char *name, int write, int passes)
+{
+    uint64_t ta, tb, sec, ops = 0, bytes = 0;
+    int per_io = io_size / sector_size;
+    int i, n;
+
+    ta = solo5_clock_monotonic();
+    for (i = 0; i < passes; i++) {
+        for (sec = 0; sec < sectors; sec += per_io) {
+            n = io_size;
+            if (sec + per_io > sectors)
+                n = (sectors - sec) * sector_size;
+            if (write && solo5_blk_write_sync(sec, buf, n) != 0)
+                return 1;
+            if (!write && solo5_blk_read_sync(sec, buf, &n) != 0)
+                return 1;
+            ops++;
+            bytes += n;
+        }
+    }
+    tb = solo5_clock_monotonic();
+    report(name, ops, bytes, tb - ta);
+    return 0;
+}
+
+/*
+ * NRAND random RAND_SIZE reads or writes, aligned to RAND_SIZE.
+ */
+static int bench_rand(const char *name, int write)
+{
+    uint64_t ta, tb, x = 88172645463325252ULL, sec;
+    uint64_t per_io = RAND_SIZE / sector_size;
+    int i, n;
+
+    ta = solo5_clock_monotonic();
+    for (i = 0; i < NRAND; i++) {
+        /* xorshift64 */
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        sec = (x % (sectors / per_io)) * per_io;
+        n = RAND_SIZE;
+        if (write && solo5_blk_write_sync(sec, buf, n) != 0)
+            return 1;
+        if (!write && solo5_blk_read_sync(sec, buf, &n) != 0)
+            return 1;
+    }
+    tb = solo5_clock_monotonic();
+    report(name, NRAND, (uint64_t)NRAND * RAND_SIZE, tb - ta);
+    return 0;
+}
+
+/*
+ * Read the whole disk (passes) times through solo5_blk_map(), checking that
+ * it contains what was last written.
+ */
+static int bench_map_scan(const uint8_t *map)
+{
+    const uint64_t *p = (const uint64_t *)map;
+    uint64_t ta, tb, i, words = sectors * sector_size / 8;
+    uint64_t pattern = 0xa5a5a5a5a5a5a5a5ULL;
+    int pass;
+
+    ta = solo5_clock_monotonic();
+    for (pass = 0; pass < PASSES; pass++) {
+        for (i = 0; i < words; i++) {
+            if (p[i] != pattern)
+                return 1;
+        }
+    }
+    tb = solo5_clock_monotonic();
+    report("map scan  ", PASSES, PASSES * words * 8, tb - ta);
+    return 0;
+}
+
+int solo5_app_main(char *cmdline __attribute__((unused)))
+{
+    puts("\n**** Solo5 standalone test_blk_bench ****\n\n");
+
+    sectors = solo5_blk_sectors();
+    sector_size = solo5_blk_sector_size();
+    memset(buf, 0xa5, sizeof buf);
+
+    /*
+     * Use large requests where supported (ukvm), otherwise single sectors.
+     */
+    io_size = IO_SIZE;
+    if (sectors < (uint64_t)(IO_SIZE / sector_size) ||
+            solo5_blk_write_sync(0, buf, IO_SIZE) != 0)
+        io_size = sector_size;
+
+    /*
+     * The first pass over the disk is reported separately, as it is when
+     * space is allocated for a sparse or overlay disk.
+     */
+    if (bench_seq("write 1st ", 1, 1) != 0) {
+        puts("ERROR: write failed\n");
+        return 1;
+    }
+    if (bench_seq("write     ", 1, PASSES) != 0) {
+        puts("ERROR: write failed\n");
+        return 1;
+    }
+    if (bench_seq("read      ", 0, PASSES) != 0) {
+        puts("ERROR: read failed\n");
+        return 1;
+    }
+    if (sector_size <= RAND_SIZE && io_size > sector_size) {
+        if (bench_rand("rand read ", 0) != 0) {
+            puts("ERROR: random read failed\n");
+            return 1;
+        }
+        if (bench_rand("rand write", 1) != 0) {
+            puts("ERROR: random write failed\n");
+            return 1;
+        }
+    }
+
+    const uint8_t *map = solo5_blk_map();
+    if (map != NULL && bench_map_scan(map) != 0) {
+        puts("ERROR: map scan failed\n");
+        return 1;
+    }
+
+    puts("SUCCESS\n");
+    return 0;
+}
@@ -0,0 +1,140 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a unikernel base layer.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../kernel/lib.c"
+
+static void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+static void putu(uint64_t n)
+{
+    char buf[21];
+    char *p = &buf[sizeof buf - 1];
+
+    *p = 0;
+    do {
+        *--p = '0' + (n % 10);
+        n /= 10;
+    } while (n);
+    puts(p);
+}
+
+#define NSEC_PER_SEC 1000000000ULL
+
+#define PAGE_SIZE   4096
+#define WALK_SIZE   (256 * 1024 * 1024)
+#define NPAGES      (WALK_SIZE / PAGE_SIZE)
+#define NSTEPS      (4 * 1024 * 1024)
+
+static uint8_t *mem;
+static uint32_t order[NPAGES];
+
+static uint64_t xorshift64(uint64_t *s)
+{
+    uint64_t x = *s;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *s = x;
+}
+
+/*
+ * Touch every page of (mem) for the first time, which makes the host fault
+ * in its backing.
+ */
+static void bench_touch(void)
+{
+    uint64_t ta, tb;
+    size_t i;
+
+    ta = solo5_clock_monotonic();
+    for (i = 0; i < WALK_SIZE; i += PAGE_SIZE)
+        mem[i] = 1;
+    tb = solo5_clock_monotonic();
+
+    puts("touch      : ");
+    putu((WALK_SIZE / (1024 * 1024)) * NSEC_PER_SEC / (tb - ta));
+    puts(" MB/s\n");
+}
+
+/*
+ * Follow a chain of pointers through all pages of (mem) in random order, so
+ * that nearly every access misses in the TLB.
+ */
+static void bench_walk(void)
+{
+    uint64_t seed = 0x9e3779b97f4a7c15ULL, ta, tb;
+    void **p;
+    size_t i, j;
+    uint32_t t;
+
+    /*
+     * Sattolo's algorithm, for a single cycle through all pages. Each pointer
+     * is on a different cache line within its page.
+     */
+    for (i = 0; i < NPAGES; i++)
+        order[i] = i;
+    for (i = NPAGES - 1; i > 0; i--) {
+        j = xorshift64(&seed) % i;
+        t = order[i];
+        order[i] = order[j];
+        order[j] = t;
+    }
+    for (i = 0; i < NPAGES; i++) {
+        uint32_t from = order[i], to = order[(i + 1) % NPAGES];
+
+        *(void **)(mem + from * PAGE_SIZE + (from % 64) * 64) =
+            mem + to * PAGE_SIZE + (to % 64) * 64;
+    }
+
+    p = (void **)(mem + order[0] * PAGE_SIZE + (order[0] % 64) * 64);
+    ta = solo5_clock_monotonic();
+    for (i = 0; i < NSTEPS; i++)
+        p = *p;
+    tb = solo5_clock_monotonic();
+    /* Keep the walk from being optimised away. */
+    if (p == NULL)
+        puts("");
+
+    puts("random walk: ");
+    putu((tb - ta) / (NSTEPS / 1000));
+    puts(" ps/access\n");
+}
+
+int solo5_app_main(char *cmdline __attribute__((unused)))
+{
+    puts("\n**** Solo5 standalone test_mem_bench ****\n\n");
+
+    mem = solo5_malloc(WALK_SIZE);
+    if (mem == NULL) {
+        puts("ERROR: could not allocate memory\n");
+        return 1;
+    }
+
+    bench_touch();
+    bench_walk();
+
+    puts("SUCCESS\n");
+    return 0;
+}
@@ -0,0 +1,231 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of Solo5, a unikernel base layer.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "solo5.h"
+#include "../../kernel/lib.c"
+
+static void puts(const char *s)
+{
+    solo5_console_write(s, strlen(s));
+}
+
+static void putu(uint64_t n)
+{
+    char buf[21];
+    char *p = &buf[sizeof buf - 1];
+
+    *p = 0;
+    do {
+        *--p = '0' + (n % 10);
+        n /= 10;
+    } while (n);
+    puts(p);
+}
+
+#define NSEC_PER_SEC 1000000000ULL
+
+#define NFRAMES    200000
+#define BATCH      32
+#define FRAME_SIZE 60
+
+/*
+ * TCP segmentation offload: one 64kB TCP/IPv4 packet is segmented by the host
+ * into TSO_MSS sized frames.
+ */
+#define TSO_HDR_LEN 54
+#define TSO_MSS     1448
+#define TSO_SIZE    (TSO_HDR_LEN + 44 * TSO_MSS)
+#define NTSO        5000
+
+static uint8_t frame[FRAME_SIZE];
+static uint8_t tso_frame[TSO_SIZE];
+static uint8_t rxbuf[BATCH][1526];
+
+/*
+ * Prints a result line of the form:
+ *     NAME: FRAMES frames, CALLS calls, FPC frames/call, PPS pps
+ *
+ * CALLS counts calls to the solo5_net_* API, not VM exits, which the guest
+ * cannot see; with network rings a call may not exit at all. Use ukvm-top to
+ * see the exits taken by the monitor.
+ */
+static void report(const char *name, uint64_t frames, uint64_t calls,
+        uint64_t nsecs)
+{
+    puts(name);
+    puts(": ");
+    putu(frames);
+    puts(" frames, ");
+    putu(calls);
+    puts(" calls, ");
+    putu(calls ? frames / calls : 0);
+    puts(" frames/call, ");
+    putu(nsecs ? (frames * NSEC_PER_SEC) / nsecs : 0);
+    puts(" pps\n");
+}
+
+static int bench_tx_sync(void)
+{
+    uint64_t ta, tb;
+    int i;
+
+    ta = solo5_clock_monotonic();
+    for (i = 0; i < NFRAMES; i++) {
+        if (solo5_net_write_sync(frame, sizeof frame) != 0)
+            return 1;
+    }
+    tb = solo5_clock_monotonic();
+    report("tx sync ", NFRAMES, NFRAMES, tb - ta);
+    return 0;
+}
+
+static int bench_tx_batch(void)
+{
+    struct solo5_net_frame frames[BATCH];
+    uint64_t ta, tb, calls = 0;
+    int i, sent = 0;
+
+    for (i = 0; i < BATCH; i++) {
+        frames[i].data = frame;
+        frames[i].len = sizeof frame;
+    }
+
+    ta = solo5_clock_monotonic();
+    while (sent < NFRAMES) {
+        int rc = solo5_net_write_batch(frames, BATCH);
+        if (rc <= 0)
+            return 1;
+        sent += rc;
+        calls++;
+    }
+    tb = solo5_clock_monotonic();
+    report("tx batch", sent, calls, tb - ta);
+    return 0;
+}
+
+static int bench_tx_tso(void)
+{
+    struct solo5_net_hdr hdr;
+    uint64_t ta, tb;
+    uint8_t *ip = &tso_frame[14], *tcp = &tso_frame[34];
+    int i;
+
+    memcpy(tso_frame, frame, 12);
+    tso_frame[12] = 0x08;                   /* ETHERTYPE_IP */
+    ip[0] = 0x45;
+    ip[2] = (TSO_SIZE - 14) >> 8;
+    ip[3] = (TSO_SIZE - 14) & 0xff;
+    ip[8] = 64;                             /* TTL */
+    ip[9] = 6;                              /* IPPROTO_TCP */
+    ip[12] = 10; ip[15] = 2;                /* 10.0.0.2 -> 10.0.0.1 */
+    ip[16] = 10; ip[19] = 1;
+    tcp[0] = 0x30; tcp[1] = 0x39;           /* port 12345 -> 9 */
+    tcp[3] = 9;
+    tcp[12] = 5 << 4;                       /* data offset */
+    tcp[13] = 0x18;                         /* PSH, ACK */
+    tcp[14] = 0xff; tcp[15] = 0xff;         /* window */
+
+    memset(&hdr, 0, sizeof hdr);
+    hdr.flags = SOLO5_NET_HDR_F_NEEDS_CSUM;
+    hdr.gso_type = SOLO5_NET_HDR_GSO_TCPV4;
+    hdr.hdr_len = TSO_HDR_LEN;
+    hdr.gso_size = TSO_MSS;
+    hdr.csum_start = 34;
+    hdr.csum_offset = 16;
+
+    ta = solo5_clock_monotonic();
+    for (i = 0; i < NTSO; i++) {
+        if (solo5_net_write_offload(&hdr, tso_frame, sizeof tso_frame) != 0)
+            return 1;
+    }
+    tb = solo5_clock_monotonic();
+    report("tx tso  ", (uint64_t)NTSO * (TSO_SIZE - TSO_HDR_LEN) / TSO_MSS,
+            NTSO, tb - ta);
+    return 0;
+}
+
+/*
+ * Drain whatever traffic arrives within one second. On a TAP or AF_PACKET
+ * interface there is no traffic generator, so this mostly measures the cost
+ * of an empty read; with --net=replay:FILE,loop the guest is never short of
+ * frames. If (want_rx) is set, receiving no frames at all is an error.
+ */
+static int bench_rx_batch(int want_rx)
+{
+    struct solo5_net_frame frames[BATCH];
+    uint64_t ta, tb, now, calls = 0, received = 0;
+    int i;
+
+    ta = solo5_clock_monotonic();
+    do {
+        for (i = 0; i < BATCH; i++) {
+            frames[i].data = rxbuf[i];
+            frames[i].len = sizeof rxbuf[i];
+        }
+        int rc = solo5_net_read_batch(frames, BATCH);
+        if (rc < 0)
+            return 1;
+        calls++;
+        received += rc;
+        now = solo5_clock_monotonic();
+        if (rc == 0)
+            solo5_poll(now + NSEC_PER_SEC / 100);
+    } while (now - ta < NSEC_PER_SEC);
+    tb = solo5_clock_monotonic();
+    report("rx batch", received, calls, tb - ta);
+    return (want_rx && received == 0) ? 1 : 0;
+}
+
+int solo5_app_main(char *cmdline)
+{
+    puts("\n**** Solo5 standalone test_net_bench ****\n\n");
+
+    /*
+     * Send to a locally administered unicast address nobody owns, using the
+     * IEEE 802 "local experimental" ethertype, so the host drops the frames.
+     */
+    memset(frame, 0, sizeof frame);
+    frame[0] = 0x02;
+    frame[5] = 0x01;
+    frame[6] = 0x02;
+    frame[12] = 0x88;
+    frame[13] = 0xb5;
+
+    if (bench_tx_sync() != 0) {
+        puts("ERROR: tx sync failed\n");
+        return 1;
+    }
+    if (bench_tx_batch() != 0) {
+        puts("ERROR: tx batch failed\n");
+        return 1;
+    }
+    if ((solo5_net_offloads() & SOLO5_NET_OFFLOAD_TSO4) &&
+            bench_tx_tso() != 0) {
+        puts("ERROR: tx tso failed\n");
+        return 1;
+    }
+    if (bench_rx_batch(strcmp(cmdline, "rx") == 0) != 0) {
+        puts("ERROR: rx batch failed\n");
+        return 1;
+    }
+
+    puts("SUCCESS\n");
+    return 0;
+}
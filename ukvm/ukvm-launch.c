@@ -0,0 +1,195 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm-launch.c: Start an instance of a unikernel from a ukvm zygote
+ * (--zygote=SOCKET), and wait for it to exit.
+ */
+
+#define _GNU_SOURCE
+#include <err.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ukvm_zygote.h"
+
+static uint64_t now_nsecs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000000ULL) + ts.tv_nsec;
+}
+
+/*
+ * Send the request (req, len) with descriptors (fds, nfds) to the zygote at
+ * (path). Returns the connection, which is closed by the zygote when the
+ * instance exits.
+ */
+static int launch(const char *path, char *req, size_t len, const int *fds,
+        int nfds)
+{
+    struct sockaddr_un sun;
+    union {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(UKVM_ZYGOTE_FDS_MAX * sizeof (int))];
+    } cmsg;
+    struct iovec iov = { .iov_base = req, .iov_len = len };
+    struct msghdr msg = {
+        .msg_iov = &iov, .msg_iovlen = 1,
+        .msg_control = cmsg.buf,
+        .msg_controllen = CMSG_SPACE(nfds * sizeof (int))
+    };
+    struct ukvm_zygote_reply reply;
+    struct cmsghdr *c;
+    int fd;
+
+    if (strlen(path) >= sizeof sun.sun_path)
+        errx(1, "Socket path too long: %s", path);
+    memset(&sun, 0, sizeof sun);
+    sun.sun_family = AF_UNIX;
+    strcpy(sun.sun_path, path);
+
+    fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+    if (fd == -1)
+        err(1, "socket() failed");
+    if (connect(fd, (struct sockaddr *)&sun, sizeof sun) == -1)
+        err(1, "Could not connect to %s", path);
+
+    memset(&cmsg, 0, sizeof cmsg);
+    c = CMSG_FIRSTHDR(&msg);
+    c->cmsg_level = SOL_SOCKET;
+    c->cmsg_type = SCM_RIGHTS;
+    c->cmsg_len = CMSG_LEN(nfds * sizeof (int));
+    memcpy(CMSG_DATA(c), fds, nfds * sizeof (int));
+    if (sendmsg(fd, &msg, 0) == -1)
+        err(1, "Could not send request");
+
+    if (recv(fd, &reply, sizeof reply, 0) != sizeof reply)
+        errx(1, "No reply from zygote");
+    if (reply.pid == -1) {
+        errno = reply.error;
+        err(1, "Zygote could not start instance");
+    }
+    return fd;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [ -f FD ]... [ -n COUNT ] SOCKET "
+            "[ MODULE OPTIONS ] [ -- ] [ ARGS ]\n", prog);
+    fprintf(stderr, "SOCKET is the --zygote=SOCKET of a ukvm zygote.\n");
+    fprintf(stderr, "The instance runs with the standard input, output and "
+            "error of %s.\n", prog);
+    fprintf(stderr, "  -f FD (pass descriptor FD to the instance, as 3, 4, "
+            "...)\n");
+    fprintf(stderr, "  -n COUNT (start COUNT instances at once and report "
+            "timings)\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    static char req[UKVM_ZYGOTE_REQ_MAX];
+    int fds[UKVM_ZYGOTE_FDS_MAX] = { 0, 1, 2 };
+    int nfds = 3, count = 1, bench = 0, opt, i;
+    const char *path;
+    size_t len = 0;
+
+    while ((opt = getopt(argc, argv, "+f:n:")) != -1) {
+        switch (opt) {
+        case 'f':
+            if (nfds == UKVM_ZYGOTE_FDS_MAX)
+                errx(1, "Too many descriptors (max=%d)",
+                        UKVM_ZYGOTE_FDS_MAX - 3);
+            fds[nfds++] = atoi(optarg);
+            break;
+        case 'n':
+            count = atoi(optarg);
+            if (count <= 0)
+                usage(argv[0]);
+            bench = 1;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (optind == argc)
+        usage(argv[0]);
+    path = argv[optind++];
+
+    for (i = optind; i < argc; i++) {
+        size_t n = strlen(argv[i]) + 1;
+
+        if (len + n > sizeof req)
+            errx(1, "Request too long (max=%zu bytes)", sizeof req);
+        memcpy(req + len, argv[i], n);
+        len += n;
+    }
+
+    struct pollfd *pfds = calloc(count, sizeof *pfds);
+    if (pfds == NULL)
+        err(1, "calloc");
+
+    uint64_t ta = now_nsecs();
+    for (i = 0; i < count; i++) {
+        pfds[i].fd = launch(path, req, len, fds, nfds);
+        pfds[i].events = POLLIN;
+    }
+    uint64_t tb = now_nsecs();
+
+    /*
+     * Wait for all instances to exit.
+     */
+    int running = count;
+    while (running) {
+        if (poll(pfds, count, -1) == -1) {
+            if (errno == EINTR)
+                continue;
+            err(1, "poll() failed");
+        }
+        for (i = 0; i < count; i++) {
+            if (pfds[i].fd != -1 && pfds[i].revents) {
+                close(pfds[i].fd);
+                pfds[i].fd = -1;
+                running--;
+            }
+        }
+    }
+    uint64_t tc = now_nsecs();
+
+    if (bench) {
+        fprintf(stderr, "%d instances: started in %" PRIu64 " us "
+                "(%" PRIu64 "/s), all exited after %" PRIu64 " us\n",
+                count, (tb - ta) / 1000,
+                (uint64_t)count * 1000000000 / (tb - ta + 1),
+                (tc - ta) / 1000);
+    }
+    return 0;
+}
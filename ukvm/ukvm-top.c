@@ -0,0 +1,313 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm-top.c: Display statistics exported by one or more running ukvm
+ * instances with --stats=PATH.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/kvm.h>
+#endif
+
+#include "ukvm_names.h"
+#include "ukvm_stats.h"
+
+#if defined(__linux__)
+static const char *kvm_exit_names[UKVM_STATS_EXITS] = {
+    [KVM_EXIT_UNKNOWN] = "unknown",
+    [KVM_EXIT_EXCEPTION] = "exception",
+    [KVM_EXIT_IO] = "io",
+    [KVM_EXIT_DEBUG] = "debug",
+    [KVM_EXIT_HLT] = "hlt",
+    [KVM_EXIT_MMIO] = "mmio",
+    [KVM_EXIT_SHUTDOWN] = "shutdown",
+    [KVM_EXIT_FAIL_ENTRY] = "fail_entry",
+    [KVM_EXIT_INTR] = "intr",
+    [KVM_EXIT_INTERNAL_ERROR] = "internal_error",
+    [KVM_EXIT_SYSTEM_EVENT] = "system_event",
+};
+#endif
+
+struct instance {
+    const char *path;
+    const char *name;
+    int valid;                  /* (prev) holds a previous sample */
+    uint64_t prev_nsecs;
+    struct ukvm_stats prev;
+};
+
+static uint64_t now_nsecs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000000ULL) + ts.tv_nsec;
+}
+
+/*
+ * Read a consistent-enough snapshot of the statistics at (path) into (s).
+ * Returns -1 if the file does not (yet) contain valid statistics.
+ */
+static int read_stats(const char *path, struct ukvm_stats *s)
+{
+    int fd = open(path, O_RDONLY);
+    ssize_t n;
+
+    if (fd == -1)
+        return -1;
+    n = pread(fd, s, sizeof *s, 0);
+    close(fd);
+    if (n != sizeof *s || s->magic != UKVM_STATS_MAGIC ||
+            s->version != UKVM_STATS_VERSION)
+        return -1;
+    return 0;
+}
+
+static uint64_t rate(uint64_t delta, uint64_t nsecs)
+{
+    return nsecs ? (uint64_t)(delta * 1000000000.0 / nsecs) : 0;
+}
+
+static unsigned percent(uint64_t delta, uint64_t nsecs)
+{
+    return nsecs ? (unsigned)(delta * 100.0 / nsecs + 0.5) : 0;
+}
+
+static void print_header(void)
+{
+    printf("%-20s %7s %9s %9s %5s %6s %5s %9s %9s %7s %8s %8s\n",
+            "NAME", "PID", "EXITS/s", "HCALLS/s", "RUN%", "HCALL%", "POLL%",
+            "RX/s", "TX/s", "DROPS", "BLKRD/s", "BLKWR/s");
+}
+
+/*
+ * Block device (i). Per-device reads and writes are only shown if there is
+ * more than one device, as the totals are in the summary line.
+ */
+static void print_blk_detail(const struct ukvm_stats *s,
+        const struct ukvm_stats *p, uint32_t i, uint64_t dt)
+{
+    const char *indent = "    ";
+    uint64_t direct = s->blk[i].direct - p->blk[i].direct;
+    uint64_t bounced = s->blk[i].bounced - p->blk[i].bounced;
+
+    if (s->ndisks > 1) {
+        printf("    disk %-9.15s %9" PRIu64 "/s rd  %9" PRIu64 "/s wr\n",
+                s->blk[i].name[0] ? s->blk[i].name : "-",
+                rate(s->blk[i].reads - p->blk[i].reads, dt),
+                rate(s->blk[i].writes - p->blk[i].writes, dt));
+        indent = "      ";
+    }
+    if (direct || bounced)
+        printf("%sblk direct %9" PRIu64 "/s  bounced %9" PRIu64 "/s (%u%%)\n",
+                indent, rate(direct, dt), rate(bounced, dt),
+                (unsigned)(bounced * 100 / (direct + bounced)));
+    if (s->blk[i].flushes != p->blk[i].flushes)
+        printf("%sblk flush  %9" PRIu64 "/s\n", indent,
+                rate(s->blk[i].flushes - p->blk[i].flushes, dt));
+}
+
+static void print_detail(const struct ukvm_stats *s, const struct ukvm_stats *p,
+        uint64_t dt)
+{
+    for (int i = 0; i < UKVM_STATS_HYPERCALLS; i++) {
+        uint64_t n = s->hypercalls[i] - p->hypercalls[i];
+        uint64_t t = s->hypercall_nsecs[i] - p->hypercall_nsecs[i];
+
+        if (n == 0)
+            continue;
+        if (ukvm_hypercall_name(i))
+            printf("    %-14s", ukvm_hypercall_name(i));
+        else
+            printf("    hypercall %-4d", i);
+        printf(" %9" PRIu64 "/s  avg %9.3f us\n", rate(n, dt),
+                t / 1000.0 / n);
+    }
+    for (uint32_t i = 0; i < s->ndisks && i < UKVM_STATS_DISKS; i++)
+        print_blk_detail(s, p, i, dt);
+    for (int i = 0; i < UKVM_STATS_EXITS; i++) {
+        uint64_t n = s->exits[i] - p->exits[i];
+        const char *name = NULL;
+
+        if (n == 0)
+            continue;
+#if defined(__linux__)
+        if (!strcmp(s->hv, "kvm"))
+            name = kvm_exit_names[i];
+#endif
+        if (name)
+            printf("    exit %-9s", name);
+        else
+            printf("    exit %-9d", i);
+        printf(" %9" PRIu64 "/s\n", rate(n, dt));
+    }
+}
+
+static void sample(struct instance *in, int detail)
+{
+    struct ukvm_stats s;
+    const struct ukvm_stats *p;
+    struct ukvm_stats zero;
+    uint64_t now, dt;
+
+    if (read_stats(in->path, &s) == -1) {
+        printf("%-20s %7s\n", in->name, "-");
+        in->valid = 0;
+        return;
+    }
+    now = now_nsecs();
+    if (kill(s.pid, 0) == -1 && errno == ESRCH) {
+        printf("%-20s %7" PRIu32 " (exited)\n", in->name, s.pid);
+        in->valid = 0;
+        return;
+    }
+
+    /*
+     * On the first sample, or if the instance was restarted, show averages
+     * since it started.
+     */
+    if (in->valid && in->prev.pid == s.pid &&
+            in->prev.start_nsecs == s.start_nsecs) {
+        p = &in->prev;
+        dt = now - in->prev_nsecs;
+    }
+    else {
+        memset(&zero, 0, sizeof zero);
+        p = &zero;
+        dt = now - s.start_nsecs;
+    }
+
+    uint64_t exits = 0, hcalls = 0;
+    for (int i = 0; i < UKVM_STATS_EXITS; i++)
+        exits += s.exits[i] - p->exits[i];
+    for (int i = 0; i < UKVM_STATS_HYPERCALLS; i++)
+        hcalls += s.hypercalls[i] - p->hypercalls[i];
+    uint64_t blkrd = 0, blkwr = 0;
+    for (uint32_t i = 0; i < s.ndisks && i < UKVM_STATS_DISKS; i++) {
+        blkrd += s.blk[i].reads - p->blk[i].reads;
+        blkwr += s.blk[i].writes - p->blk[i].writes;
+    }
+
+    printf("%-20s %7" PRIu32 " %9" PRIu64 " %9" PRIu64 " %5u %6u %5u "
+            "%9" PRIu64 " %9" PRIu64 " %7" PRIu64 " %8" PRIu64 " %8" PRIu64
+            "\n",
+            in->name, s.pid, rate(exits, dt), rate(hcalls, dt),
+            percent(s.run_nsecs - p->run_nsecs, dt),
+            percent(s.hypercall_total_nsecs - p->hypercall_total_nsecs, dt),
+            percent(s.poll_nsecs - p->poll_nsecs, dt),
+            rate(s.net.rx_packets - p->net.rx_packets, dt),
+            rate(s.net.tx_packets - p->net.tx_packets, dt),
+            (s.net.rx_drops - p->net.rx_drops) +
+                (s.net.tx_drops - p->net.tx_drops),
+            rate(blkrd, dt), rate(blkwr, dt));
+    if (detail)
+        print_detail(&s, p, dt);
+
+    in->prev = s;
+    in->prev_nsecs = now;
+    in->valid = 1;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [ -d ] [ -i SECONDS ] [ -n COUNT ] FILE...\n",
+            prog);
+    fprintf(stderr, "FILE is the --stats=PATH of a ukvm instance, "
+            "e.g. /dev/shm/ukvm.*\n");
+    fprintf(stderr, "  -d (show per-hypercall and per-exit detail)\n");
+    fprintf(stderr, "  -i SECONDS (refresh interval, default 1)\n");
+    fprintf(stderr, "  -n COUNT (exit after COUNT refreshes)\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    struct instance *ins;
+    int detail = 0, count = -1, ninstances, opt;
+    double interval = 1.0;
+    int clear = isatty(STDOUT_FILENO);
+
+    while ((opt = getopt(argc, argv, "di:n:")) != -1) {
+        switch (opt) {
+        case 'd':
+            detail = 1;
+            break;
+        case 'i':
+            interval = strtod(optarg, NULL);
+            if (interval <= 0)
+                usage(argv[0]);
+            break;
+        case 'n':
+            count = atoi(optarg);
+            if (count <= 0)
+                usage(argv[0]);
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    ninstances = argc - optind;
+    if (ninstances == 0)
+        usage(argv[0]);
+
+    ins = calloc(ninstances, sizeof *ins);
+    if (ins == NULL)
+        err(1, "calloc");
+    for (int i = 0; i < ninstances; i++) {
+        const char *slash;
+
+        ins[i].path = argv[optind + i];
+        slash = strrchr(ins[i].path, '/');
+        ins[i].name = slash ? slash + 1 : ins[i].path;
+    }
+
+    for (int iter = 0; count < 0 || iter < count; iter++) {
+        struct timespec ts;
+
+        if (iter > 0) {
+            ts.tv_sec = (time_t)interval;
+            ts.tv_nsec = (long)((interval - ts.tv_sec) * 1e9);
+            nanosleep(&ts, NULL);
+        }
+        if (clear)
+            printf("\033[H\033[2J");
+        print_header();
+        for (int i = 0; i < ninstances; i++)
+            sample(&ins[i], detail);
+        if (!clear)
+            printf("\n");
+        fflush(stdout);
+    }
+
+    return 0;
+}
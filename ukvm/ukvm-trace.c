@@ -0,0 +1,204 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm-trace.c: Summarise a hypercall trace file written by ukvm --trace.
+ *
+ * For each hypercall, prints log2 histograms of the time spent in the
+ * handler and of the time between successive calls. Also prints a histogram
+ * of the time the guest ran between any two hypercalls.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <err.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ukvm_names.h"
+#include "ukvm_trace.h"
+
+#define BUCKETS 64
+#define BAR_WIDTH 40
+
+struct hist {
+    uint64_t count, total, min, max;
+    uint64_t bucket[BUCKETS];
+};
+
+struct hypercall {
+    struct hist latency;
+    struct hist interval;
+    uint64_t last_enter;
+};
+
+static struct hypercall hcs[256];
+static struct hist guest;
+/*
+ * Units in which times are reported: nanoseconds if the cycle counter
+ * frequency is known, otherwise raw cycles.
+ */
+static double cycles_per_unit = 1.0;
+static const char *unit = "cycles";
+
+static void hist_add(struct hist *h, uint64_t cycles)
+{
+    uint64_t v = (uint64_t)(cycles / cycles_per_unit);
+    int b = v ? 64 - __builtin_clzll(v) : 0;
+
+    if (h->count == 0 || v < h->min)
+        h->min = v;
+    if (v > h->max)
+        h->max = v;
+    h->count++;
+    h->total += v;
+    h->bucket[b < BUCKETS ? b : BUCKETS - 1]++;
+}
+
+static void hist_print(const char *title, const struct hist *h)
+{
+    uint64_t peak = 0;
+    int lo = BUCKETS, hi = 0;
+
+    if (h->count == 0)
+        return;
+    printf("  %s (%s): count %" PRIu64 ", min %" PRIu64 ", mean %" PRIu64
+            ", max %" PRIu64 "\n", title, unit, h->count, h->min,
+            h->total / h->count, h->max);
+    for (int i = 0; i < BUCKETS; i++) {
+        if (h->bucket[i] == 0)
+            continue;
+        if (i < lo)
+            lo = i;
+        hi = i;
+        if (h->bucket[i] > peak)
+            peak = h->bucket[i];
+    }
+    for (int i = lo; i <= hi; i++) {
+        uint64_t from = i ? 1ULL << (i - 1) : 0;
+        uint64_t to = 1ULL << i;
+        int n = (int)(h->bucket[i] * BAR_WIDTH / peak);
+
+        printf("    [%12" PRIu64 ", %12" PRIu64 ") %10" PRIu64 " |%.*s\n",
+                from, to, h->bucket[i], n,
+                "########################################");
+    }
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [ -d ] FILE\n", prog);
+    fprintf(stderr, "FILE is a trace written by ukvm --trace=FILE\n");
+    fprintf(stderr, "  -d (dump all records instead of summarising)\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    struct ukvm_trace_hdr hdr;
+    struct ukvm_trace_rec recs[4096];
+    uint64_t first = 0, last_exit = 0, n = 0;
+    int dump = 0, opt;
+    size_t nr;
+    FILE *f;
+
+    while ((opt = getopt(argc, argv, "d")) != -1) {
+        switch (opt) {
+        case 'd':
+            dump = 1;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (optind != argc - 1)
+        usage(argv[0]);
+
+    f = fopen(argv[optind], "rb");
+    if (f == NULL)
+        err(1, "%s", argv[optind]);
+    if (fread(&hdr, sizeof hdr, 1, f) != 1)
+        errx(1, "%s: Short read", argv[optind]);
+    if (hdr.magic != UKVM_TRACE_MAGIC || hdr.version != UKVM_TRACE_VERSION ||
+            hdr.rec_size != sizeof (struct ukvm_trace_rec))
+        errx(1, "%s: Not a ukvm trace file, or unsupported version",
+                argv[optind]);
+    if (hdr.cycles_per_sec) {
+        cycles_per_unit = hdr.cycles_per_sec / 1e9;
+        unit = "ns";
+    }
+    else
+        warnx("%s: Trace was not closed cleanly, reporting cycles",
+                argv[optind]);
+
+    while ((nr = fread(recs, sizeof recs[0], 4096, f)) > 0) {
+        for (size_t i = 0; i < nr; i++) {
+            const struct ukvm_trace_rec *r = &recs[i];
+            unsigned hc = UKVM_TRACE_REC_NR(r);
+            const char *name = ukvm_hypercall_name(hc);
+
+            if (n == 0)
+                first = r->enter;
+            if (dump) {
+                printf("%14.0f %-10s %10.0f\n",
+                        (r->enter - first) / cycles_per_unit,
+                        name ? name : "?",
+                        UKVM_TRACE_REC_CYCLES(r) / cycles_per_unit);
+            }
+            else {
+                hist_add(&hcs[hc].latency, UKVM_TRACE_REC_CYCLES(r));
+                if (hcs[hc].latency.count > 1)
+                    hist_add(&hcs[hc].interval, r->enter - hcs[hc].last_enter);
+                hcs[hc].last_enter = r->enter;
+                if (n > 0 && r->enter >= last_exit)
+                    hist_add(&guest, r->enter - last_exit);
+            }
+            last_exit = UKVM_TRACE_REC_EXIT(r);
+            n++;
+        }
+    }
+    fclose(f);
+    if (dump)
+        return 0;
+
+    printf("%" PRIu64 " records, %" PRIu64 " dropped", n, hdr.drops);
+    if (hdr.cycles_per_sec)
+        printf(", %.3f s, cycle counter at %.1f MHz",
+                (last_exit - first) / (double)hdr.cycles_per_sec,
+                hdr.cycles_per_sec / 1e6);
+    printf("\n\nguest\n");
+    hist_print("time between hypercalls", &guest);
+    for (unsigned i = 0; i < 256; i++) {
+        const char *name = ukvm_hypercall_name(i);
+
+        if (hcs[i].latency.count == 0)
+            continue;
+        if (name)
+            printf("\n%s\n", name);
+        else
+            printf("\nhypercall %u\n", i);
+        hist_print("latency", &hcs[i].latency);
+        hist_print("interval", &hcs[i].interval);
+    }
+
+    return 0;
+}
@@ -35,6 +35,7 @@
 #define UKVM_HOST
 #include "ukvm_guest.h"
 #include "ukvm_gdb.h"
+#include "ukvm_stats.h"
 
 /*
  * Hypervisor {arch,backend}-independent data is defined here.
@@ -48,10 +49,30 @@ struct ukvm_hv {
 
 /*
  * Load an ELF binary from (file) into (mem_size) bytes of (mem), returning
- * the entry point (gpa_ep) and last byte used by the binary (gpa_kend).
+ * the entry point (gpa_ep) and last byte used by the binary (gpa_kend). If
+ * (map) is set, read-only segments may be mapped from (file) over (mem)
+ * instead of being copied.
  */
-void ukvm_elf_load(const char *file, uint8_t *mem, size_t mem_size,
-        ukvm_gpa_t *p_entry, ukvm_gpa_t *p_end);                
+void ukvm_elf_load(const char *file, uint8_t *mem, size_t mem_size, int map,
+        ukvm_gpa_t *p_entry, ukvm_gpa_t *p_end);
+
+/*
+ * Apply the protections of the segments of the binary last loaded by
+ * ukvm_elf_load() to a new mapping (mem) of the same guest memory.
+ */
+void ukvm_elf_protect(uint8_t *mem);
+
+/*
+ * Read the function symbols of the ELF binary last loaded by ukvm_elf_load()
+ * into a newly allocated array (*syms) of (*nsyms) entries, sorted by
+ * address. Returns 0 on success, -1 if the binary has no symbol table.
+ */
+struct ukvm_elf_sym {
+    uint64_t addr;
+    uint64_t size;
+    const char *name;
+};
+int ukvm_elf_load_symbols(struct ukvm_elf_sym **syms, size_t *nsyms);
 
 /*
  * Check that (gpa) and (gpa + sz) are within guest memory. Returns a host-side
@@ -81,6 +102,20 @@ inline void *ukvm_checked_gpa_p(struct ukvm_hv *hv, ukvm_gpa_t gpa, size_t sz,
  */
 struct ukvm_hv *ukvm_hv_init(size_t mem_size);
 
+/*
+ * Backing for guest memory (--mem-hugepages), used by ukvm_hv_init().
+ * Backends fall back to normal pages, with a warning, if the requested kind
+ * of huge pages is not available.
+ */
+enum ukvm_hugepages {
+    UKVM_HUGEPAGES_NONE = 0,        /* Normal pages (default) */
+    UKVM_HUGEPAGES_AUTO,            /* hugetlbfs if available, else THP */
+    UKVM_HUGEPAGES_THP,             /* Transparent huge pages */
+    UKVM_HUGEPAGES_HUGETLBFS        /* hugetlbfs, at (ukvm_hugetlbfs_path) */
+};
+extern enum ukvm_hugepages ukvm_hugepages;
+extern const char *ukvm_hugetlbfs_path;    /* NULL for MAP_HUGETLB */
+
 /*
  * Computes the memory size to use for this monitor, based on the user-provided
  * value (rounding down if necessary).
@@ -95,16 +130,64 @@ void ukvm_hv_mem_size(size_t *mem_size);
 void ukvm_hv_vcpu_init(struct ukvm_hv *hv, ukvm_gpa_t gpa_ep,
         ukvm_gpa_t gpa_kend, char **cmdline);
 
+/*
+ * Map (len) bytes of host memory at (addr), which must be page aligned,
+ * read-only into the guest beyond the end of guest memory, returning the guest
+ * physical address of the mapping in (*gpa). Must be called after
+ * ukvm_hv_vcpu_init(). Returns 0 on success, -1 if the mapping could not be
+ * made or is not supported.
+ */
+int ukvm_hv_map_readonly(struct ukvm_hv *hv, void *addr, size_t len,
+        ukvm_gpa_t *gpa);
+
+/*
+ * Save the state of the VCPU, which must be stopped in a hypercall, into a
+ * buffer of (*len) bytes returned in (*state). The state is that of the VCPU
+ * once the hypercall has completed. Returns 0 on success, -1 if not supported.
+ */
+int ukvm_hv_vcpu_save(struct ukvm_hv *hv, void **state, size_t *len);
+
+/*
+ * Load the VCPU state (state) of (len) bytes, as saved by
+ * ukvm_hv_vcpu_save(), into a VCPU initialised by ukvm_hv_vcpu_init(). The
+ * guest's cycle counter is advanced by (nsecs). Returns 0 on success, -1 if
+ * the state cannot be loaded on this host.
+ */
+int ukvm_hv_vcpu_restore(struct ukvm_hv *hv, const void *state, size_t len,
+        uint64_t nsecs);
+
 /*
  * Run the VCPU. Returns on normal guest exit.
  */
 void ukvm_hv_vcpu_loop(struct ukvm_hv *hv);
 
+/*
+ * Cause the VCPU to stop running the guest as soon as possible, so that
+ * ukvm_hv_vcpu_loop() can call ukvm_profile_sample(). May be called from a
+ * signal handler.
+ */
+void ukvm_hv_vcpu_kick(struct ukvm_hv *hv);
+
+/*
+ * Read the guest program counter (*pc) and frame pointer (*fp) of the
+ * stopped VCPU. Returns 0 on success, -1 if not supported.
+ */
+int ukvm_hv_vcpu_sample(struct ukvm_hv *hv, uint64_t *pc, uint64_t *fp);
+
 /*
  * Register the file descriptor (fd) for use with UKVM_HYPERCALL_POLL.
  */
 int ukvm_core_register_pollfd(int fd);
 
+/*
+ * Replace the file descriptor (oldfd) previously registered for use with
+ * UKVM_HYPERCALL_POLL with (newfd). If (fn) is not NULL, it is called on the
+ * VCPU thread each time UKVM_HYPERCALL_POLL returns with (newfd) readable, and
+ * is expected to consume the pending event (e.g. drain a notification pipe).
+ */
+typedef void (*ukvm_pollfd_fn_t)(int fd);
+int ukvm_core_replace_pollfd(int oldfd, int newfd, ukvm_pollfd_fn_t fn);
+
 /*
  * Register (fn) as the handler for hypercall (nr).
  */
@@ -116,6 +199,100 @@ int ukvm_core_register_hypercall(int nr, ukvm_hypercall_fn_t fn);
  */
 extern ukvm_hypercall_fn_t ukvm_core_hypercalls[];
 
+/*
+ * Dispatch hypercall (nr) with argument (gpa), aborting if (nr) has no
+ * handler. Backends must use this rather than ukvm_core_hypercalls[]
+ * directly, so that hypercalls are accounted for in ukvm_stats.
+ */
+void ukvm_core_hypercall(struct ukvm_hv *hv, int nr, ukvm_gpa_t gpa);
+
+/*
+ * Statistics (--stats). (ukvm_stats) always points to valid storage, so
+ * counters may be incremented unconditionally; (ukvm_stats_enabled) is set
+ * if the statistics are being exported, and should guard any work beyond a
+ * counter increment, such as taking timestamps with ukvm_stats_now().
+ *
+ * Counters which may be updated from more than one thread must use
+ * UKVM_STATS_ADD().
+ */
+extern struct ukvm_stats *ukvm_stats;
+extern int ukvm_stats_enabled;
+uint64_t ukvm_stats_now(void);
+
+#define UKVM_STATS_ADD(field, n) \
+    __atomic_fetch_add(&ukvm_stats->field, (n), __ATOMIC_RELAXED)
+
+#define UKVM_STATS_EXIT(reason) \
+    do { \
+        if ((reason) < UKVM_STATS_EXITS) \
+            ukvm_stats->exits[(reason)]++; \
+    } while (0)
+
+/*
+ * Hypercall tracing (--trace). ukvm_trace_hypercall() records a hypercall
+ * (nr) whose handler ran from cycle counter values (enter) to (exit), and
+ * must only be called from the VCPU thread while (ukvm_trace_enabled) is set.
+ */
+extern int ukvm_trace_enabled;
+void ukvm_trace_init(const char *path);
+void ukvm_trace_hypercall(int nr, uint64_t enter, uint64_t exit);
+
+/*
+ * Guest profiling (--profile). (ukvm_profile_pending) is set when a sample
+ * is due; the backend's VCPU loop must then call ukvm_profile_sample() once
+ * the VCPU has stopped.
+ */
+extern volatile int ukvm_profile_pending;
+void ukvm_profile_init(struct ukvm_hv *hv, const char *arg);
+void ukvm_profile_sample(struct ukvm_hv *hv);
+
+static inline uint64_t ukvm_trace_cycles(void)
+{
+#if defined(__x86_64__)
+    uint32_t lo, hi;
+
+    __asm__ __volatile__("rdtsc" : "=a" (lo), "=d" (hi));
+    return ((uint64_t)hi << 32) | lo;
+#elif defined(__aarch64__)
+    uint64_t v;
+
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r" (v));
+    return v;
+#else
+#error Unsupported architecture
+#endif
+}
+
+/*
+ * Snapshots (--snapshot, --restore). ukvm_snapshot_init() arranges for a
+ * snapshot to be saved to (path) on UKVM_HYPERCALL_SNAPSHOT, whose handler is
+ * ukvm_snapshot_hypercall(). ukvm_snapshot_open() validates the snapshot
+ * (path) and returns its guest memory size, and ukvm_snapshot_restore() then
+ * loads it into a (hv) of that size after ukvm_hv_vcpu_init().
+ * ukvm_snapshot_move_fd() moves the descriptor of the open snapshot to one
+ * >= (min).
+ */
+void ukvm_snapshot_init(const char *path);
+void ukvm_snapshot_hypercall(struct ukvm_hv *hv, ukvm_gpa_t gpa);
+size_t ukvm_snapshot_open(const char *path);
+void ukvm_snapshot_move_fd(int min);
+void ukvm_snapshot_restore(struct ukvm_hv *hv);
+
+/*
+ * Zygote mode (--zygote). ukvm_zygote_serve() loads (elffile) into a guest
+ * image of (mem_size) bytes, and serves launch requests on the socket (path)
+ * by forking. It only returns in a new instance, with (argc, argv) set to the
+ * instance's options and arguments, and the image's entry point and kernel end
+ * in (gpa_ep, gpa_kend). ukvm_zygote_map() then maps the image copy-on-write
+ * into a (hv) created by the instance, before ukvm_hv_vcpu_init().
+ *
+ * If (elffile) is NULL, no image is loaded and instances are instead restored
+ * from the snapshot opened with ukvm_snapshot_open().
+ */
+void ukvm_zygote_serve(const char *path, const char *elffile, size_t mem_size,
+        int *argc, char ***argv, ukvm_gpa_t *gpa_ep, ukvm_gpa_t *gpa_kend);
+void ukvm_zygote_map(struct ukvm_hv *hv);
+
 /*
  * Register a custom vmexit handler (fn). (fn) must return 0 if the vmexit was
  * handled, -1 if not.
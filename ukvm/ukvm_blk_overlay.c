@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_blk_overlay.c: Copy-on-write overlay disks (--disk-base).
+ *
+ * An overlay is a delta file on top of a read-only raw base image. The delta
+ * holds only the clusters which have been written by the guest; all other
+ * reads are served from the base. Clusters are allocated in the delta on
+ * first write, copying in the rest of the cluster from the base.
+ *
+ * Delta file layout, in host byte order, with all offsets in bytes:
+ *
+ *     cluster 0:   struct overlay_header
+ *     l1_offset:   L1 table, (l1_entries) offsets of L2 tables
+ *     ...          L2 tables and data clusters, in order of allocation
+ *
+ * Each L2 table is one cluster of offsets of data clusters. An offset of 0
+ * means not allocated. The L1 table is kept in memory, and recently used L2
+ * tables in a small cache. Updates to either are written through to the
+ * delta immediately, after the data they refer to. With --disk-cache=writeback
+ * that data is also synced first, so that after a host crash a table never
+ * points at a cluster which did not reach the disk; with writethrough every
+ * write is synchronous already, and with unsafe no such promise is made.
+ *
+ * This file is included from ukvm_module_blk.c.
+ */
+
+#define OVERLAY_MAGIC           0x31574f434d564b55ULL   /* "UKVMCOW1" */
+#define OVERLAY_VERSION         1
+#define OVERLAY_CLUSTER_BITS    16
+#define OVERLAY_L2_CACHE        16
+
+struct overlay_header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t cluster_bits;
+    uint64_t size;                      /* Virtual disk size */
+    uint64_t l1_offset;
+    uint64_t l1_entries;
+};
+
+struct overlay_l2 {
+    uint64_t offset;                    /* 0 if this slot is unused */
+    uint64_t *table;
+    uint64_t last_used;
+};
+
+struct overlay {
+    int fd, basefd;
+    off_t base_size;
+    size_t cluster_size;
+    unsigned l2_bits;                   /* log2 of entries per L2 table */
+    uint64_t *l1;
+    struct overlay_header hdr;
+    off_t end;                          /* Where the next cluster goes */
+    struct overlay_l2 cache[OVERLAY_L2_CACHE];
+    uint64_t clock;
+    uint8_t *cow;                       /* One cluster */
+};
+
+static int ov_pwrite_full(struct overlay *ov, const void *buf, size_t len,
+        off_t pos)
+{
+    return pwrite(ov->fd, buf, len, pos) == (ssize_t)len ? 0 : -1;
+}
+
+static off_t ov_alloc_cluster(struct overlay *ov)
+{
+    off_t pos = ov->end;
+
+    ov->end += ov->cluster_size;
+    return pos;
+}
+
+/*
+ * Make everything written to the delta so far durable before a table is
+ * pointed at it.
+ */
+static int ov_barrier(struct overlay *ov)
+{
+    if (cache_mode != CACHE_WRITEBACK)
+        return 0;
+    return fdatasync(ov->fd);
+}
+
+/*
+ * Sets (*table) to the L2 table for L1 index (i), allocating it if (alloc) is
+ * set, or to NULL if it is not allocated. The table remains valid until the
+ * next call. Returns -1 on error.
+ */
+static int ov_l2(struct overlay *ov, uint64_t i, int alloc, uint64_t **table)
+{
+    struct overlay_l2 *e, *victim = &ov->cache[0];
+    unsigned j;
+
+    *table = NULL;
+    if (ov->l1[i] == 0 && !alloc)
+        return 0;
+    for (j = 0; j < OVERLAY_L2_CACHE; j++) {
+        e = &ov->cache[j];
+        if (ov->l1[i] != 0 && e->offset == ov->l1[i]) {
+            e->last_used = ++ov->clock;
+            *table = e->table;
+            return 0;
+        }
+        if (e->last_used < victim->last_used)
+            victim = e;
+    }
+    victim->offset = 0;
+
+    if (ov->l1[i] == 0) {
+        off_t pos = ov_alloc_cluster(ov);
+
+        memset(victim->table, 0, ov->cluster_size);
+        if (ov_pwrite_full(ov, victim->table, ov->cluster_size, pos) == -1 ||
+                ov_barrier(ov) == -1)
+            return -1;
+        ov->l1[i] = pos;
+        if (ov_pwrite_full(ov, &ov->l1[i], sizeof ov->l1[i],
+                    ov->hdr.l1_offset + i * sizeof ov->l1[i]) == -1) {
+            ov->l1[i] = 0;
+            return -1;
+        }
+    }
+    else if (pread(ov->fd, victim->table, ov->cluster_size, ov->l1[i]) !=
+            (ssize_t)ov->cluster_size)
+        return -1;
+
+    victim->offset = ov->l1[i];
+    victim->last_used = ++ov->clock;
+    *table = victim->table;
+    return 0;
+}
+
+/*
+ * Read (len) bytes at (pos) from the base, zero filling past its end.
+ */
+static int ov_read_base(struct overlay *ov, uint8_t *buf, size_t len,
+        off_t pos)
+{
+    ssize_t ret = 0;
+
+    if (pos < ov->base_size) {
+        ret = pread(ov->basefd, buf, len, pos);
+        if (ret < 0)
+            return -1;
+    }
+    memset(buf + ret, 0, len - ret);
+    return 0;
+}
+
+static ssize_t overlay_pread(struct overlay *ov, void *buf, size_t len,
+        off_t pos)
+{
+    uint8_t *p = buf;
+    size_t done = 0;
+
+    while (done < len) {
+        off_t cpos = pos + done;
+        uint64_t cluster = cpos >> ov->hdr.cluster_bits;
+        size_t skip = cpos & (ov->cluster_size - 1);
+        size_t n = ov->cluster_size - skip;
+        uint64_t *l2;
+
+        if (n > len - done)
+            n = len - done;
+        if (ov_l2(ov, cluster >> ov->l2_bits, 0, &l2) == -1)
+            return -1;
+        if (l2 && l2[cluster & ((1 << ov->l2_bits) - 1)]) {
+            off_t data = l2[cluster & ((1 << ov->l2_bits) - 1)];
+
+            if (pread(ov->fd, p + done, n, data + skip) != (ssize_t)n)
+                return -1;
+        }
+        else if (ov_read_base(ov, p + done, n, cpos) == -1)
+            return -1;
+        done += n;
+    }
+    return len;
+}
+
+static ssize_t overlay_pwrite(struct overlay *ov, const void *buf,
+        size_t len, off_t pos)
+{
+    const uint8_t *p = buf;
+    size_t done = 0;
+
+    while (done < len) {
+        off_t cpos = pos + done;
+        uint64_t cluster = cpos >> ov->hdr.cluster_bits;
+        uint64_t idx = cluster & ((1 << ov->l2_bits) - 1);
+        size_t skip = cpos & (ov->cluster_size - 1);
+        size_t n = ov->cluster_size - skip;
+        uint64_t *l2;
+        off_t data;
+
+        if (n > len - done)
+            n = len - done;
+        if (ov_l2(ov, cluster >> ov->l2_bits, 1, &l2) == -1)
+            return -1;
+
+        if (l2[idx]) {
+            if (pwrite(ov->fd, p + done, n, l2[idx] + skip) != (ssize_t)n)
+                return -1;
+            done += n;
+            continue;
+        }
+
+        /*
+         * First write to this cluster: copy in whatever part of it is not
+         * being written from the base, write it out, and only once it is
+         * durable point the L2 table at it.
+         */
+        if (n != ov->cluster_size &&
+                ov_read_base(ov, ov->cow, ov->cluster_size, cpos - skip) == -1)
+            return -1;
+        memcpy(ov->cow + skip, p + done, n);
+        data = ov_alloc_cluster(ov);
+        if (ov_pwrite_full(ov, ov->cow, ov->cluster_size, data) == -1 ||
+                ov_barrier(ov) == -1)
+            return -1;
+        l2[idx] = data;
+        if (ov_pwrite_full(ov, &l2[idx], sizeof l2[idx],
+                    ov->l1[cluster >> ov->l2_bits] + idx * sizeof l2[idx])
+                == -1) {
+            l2[idx] = 0;
+            return -1;
+        }
+        done += n;
+    }
+    return len;
+}
+
+/*
+ * One L1 entry is needed per L2 table, each of which covers (cluster size / 8)
+ * clusters.
+ */
+static uint64_t overlay_l1_entries(const struct overlay_header *h)
+{
+    unsigned bits = 2 * h->cluster_bits - 3;
+    uint64_t n = (h->size + ((uint64_t)1 << bits) - 1) >> bits;
+
+    return n ? n : 1;
+}
+
+/*
+ * Open the overlay with delta (fd) on top of the base image at (base),
+ * creating the overlay metadata if the delta is empty. The size of the
+ * virtual disk is in (hdr.size) of the returned overlay.
+ */
+static struct overlay *overlay_open(int fd, const char *delta,
+        const char *base)
+{
+    struct overlay *ov;
+    struct overlay_header *h;
+    off_t size;
+    size_t l1_size;
+    unsigned i;
+
+    ov = calloc(1, sizeof *ov);
+    if (ov == NULL)
+        err(1, "malloc");
+    h = &ov->hdr;
+    ov->fd = fd;
+    ov->basefd = open(base, O_RDONLY);
+    if (ov->basefd == -1)
+        err(1, "Could not open base disk: %s", base);
+    ov->base_size = lseek(ov->basefd, 0, SEEK_END);
+    if (ov->base_size == -1)
+        err(1, "%s", base);
+
+    size = lseek(fd, 0, SEEK_END);
+    if (size == -1)
+        err(1, "%s", delta);
+    if (size == 0) {
+        h->magic = OVERLAY_MAGIC;
+        h->version = OVERLAY_VERSION;
+        h->cluster_bits = OVERLAY_CLUSTER_BITS;
+        h->size = ov->base_size & ~(off_t)511;
+        h->l1_offset = (off_t)1 << h->cluster_bits;
+        h->l1_entries = overlay_l1_entries(h);
+    }
+    else if (pread(fd, h, sizeof *h, 0) != sizeof *h ||
+            h->magic != OVERLAY_MAGIC || h->version != OVERLAY_VERSION ||
+            h->cluster_bits < 12 || h->cluster_bits > 24 ||
+            h->l1_entries < overlay_l1_entries(h))
+        errx(1, "%s: Not a ukvm overlay disk", delta);
+
+    ov->cluster_size = (size_t)1 << h->cluster_bits;
+    ov->l2_bits = h->cluster_bits - 3;
+    l1_size = h->l1_entries * sizeof (uint64_t);
+    ov->l1 = calloc(h->l1_entries, sizeof (uint64_t));
+    ov->cow = malloc(ov->cluster_size);
+    if (ov->l1 == NULL || ov->cow == NULL)
+        err(1, "malloc");
+    for (i = 0; i < OVERLAY_L2_CACHE; i++) {
+        ov->cache[i].table = malloc(ov->cluster_size);
+        if (ov->cache[i].table == NULL)
+            err(1, "malloc");
+    }
+
+    if (size == 0) {
+        memset(ov->cow, 0, ov->cluster_size);
+        memcpy(ov->cow, h, sizeof *h);
+        if (ov_pwrite_full(ov, ov->cow, ov->cluster_size, 0) == -1 ||
+                ov_pwrite_full(ov, ov->l1, l1_size, h->l1_offset) == -1)
+            err(1, "Could not create overlay disk: %s", delta);
+        size = h->l1_offset + l1_size;
+    }
+    else if (pread(fd, ov->l1, l1_size, h->l1_offset) != (ssize_t)l1_size)
+        errx(1, "%s: Could not read L1 table", delta);
+
+    /*
+     * New clusters are allocated at the end of the delta, rounded up to a
+     * cluster boundary.
+     */
+    ov->end = (size + ov->cluster_size - 1) & ~(off_t)(ov->cluster_size - 1);
+    return ov;
+}
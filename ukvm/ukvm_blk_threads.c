@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_blk_threads.c: Asynchronous block I/O engine using a pool of host
+ * threads, each servicing one request at a time with pread(), pwrite() or
+ * fdatasync().
+ * Used where io_uring is not available.
+ *
+ * This file is included from ukvm_module_blk.c.
+ */
+
+#define BLK_THREADS 8
+
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    struct blk_req *head, **tail;       /* Protected by (lock) */
+    struct blk_req *batch, **batch_tail; /* VCPU thread only */
+} pool = {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .cond = PTHREAD_COND_INITIALIZER,
+    .tail = &pool.head,
+    .batch_tail = &pool.batch
+};
+
+static void *threads_fn(void *arg)
+{
+    struct blk_req *req;
+    ssize_t ret;
+
+    (void)arg;
+
+    for (;;) {
+        pthread_mutex_lock(&pool.lock);
+        while (pool.head == NULL)
+            pthread_cond_wait(&pool.cond, &pool.lock);
+        req = pool.head;
+        pool.head = req->next;
+        if (pool.head == NULL)
+            pool.tail = &pool.head;
+        pthread_mutex_unlock(&pool.lock);
+
+        if (req->op == UKVM_BLK_OP_FLUSH)
+            ret = fdatasync(req->disk->fd);
+        else if (req->op == UKVM_BLK_OP_WRITE)
+            ret = pwrite(req->disk->fd, req->iov.iov_base, req->iov.iov_len,
+                    req->pos);
+        else
+            ret = pread(req->disk->fd, req->iov.iov_base, req->iov.iov_len,
+                    req->pos);
+        blk_complete(req, ret);
+    }
+
+    return NULL;
+}
+
+static int threads_init(void)
+{
+    pthread_t thread;
+    sigset_t all, old;
+    int i;
+
+    /*
+     * Signals must continue to be delivered to the VCPU thread only.
+     */
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+    for (i = 0; i < BLK_THREADS; i++) {
+        if (pthread_create(&thread, NULL, threads_fn, NULL) != 0)
+            errx(1, "Could not create block I/O thread");
+    }
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    return 0;
+}
+
+static void threads_submit(struct blk_req *req)
+{
+    req->next = NULL;
+    *pool.batch_tail = req;
+    pool.batch_tail = &req->next;
+}
+
+static void threads_start(void)
+{
+    if (pool.batch == NULL)
+        return;
+
+    pthread_mutex_lock(&pool.lock);
+    *pool.tail = pool.batch;
+    pool.tail = pool.batch_tail;
+    pthread_cond_broadcast(&pool.cond);
+    pthread_mutex_unlock(&pool.lock);
+
+    pool.batch = NULL;
+    pool.batch_tail = &pool.batch;
+}
+
+static struct blk_engine threads_engine = {
+    .name = "threads",
+    .init = threads_init,
+    .submit = threads_submit,
+    .start = threads_start
+};
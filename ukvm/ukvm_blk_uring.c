@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_blk_uring.c: Asynchronous block I/O engine using Linux io_uring.
+ *
+ * Requests are queued on the io_uring submission queue by the VCPU thread and
+ * started with a single io_uring_enter() per UKVM_HYPERCALL_BLKSUBMIT. A
+ * completion thread waits for and reaps io_uring completions. The raw system
+ * calls are used, so that liburing is not required.
+ *
+ * This file is included from ukvm_module_blk.c.
+ */
+
+#if defined(__linux__) && defined(__NR_io_uring_setup) && \
+    defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define UKVM_BLK_URING
+#endif
+#endif
+
+#ifdef UKVM_BLK_URING
+
+#include <linux/io_uring.h>
+
+static struct {
+    int fd;
+    unsigned *sq_tail, *sq_mask, *sq_array;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    unsigned pending;           /* Queued, but not yet passed to the kernel */
+    pthread_t thread;
+} uring;
+
+static int uring_enter(unsigned to_submit, unsigned min_complete,
+        unsigned flags)
+{
+    return syscall(__NR_io_uring_enter, uring.fd, to_submit, min_complete,
+            flags, NULL, 0);
+}
+
+static void *uring_thread_fn(void *arg)
+{
+    (void)arg;
+
+    for (;;) {
+        unsigned head = *uring.cq_head;
+        unsigned tail = __atomic_load_n(uring.cq_tail, __ATOMIC_ACQUIRE);
+
+        if (head == tail) {
+            if (uring_enter(0, 1, IORING_ENTER_GETEVENTS) == -1 &&
+                    errno != EINTR)
+                err(1, "io_uring_enter");
+            continue;
+        }
+        while (head != tail) {
+            struct io_uring_cqe *cqe = &uring.cqes[head & *uring.cq_mask];
+            struct blk_req *req = (struct blk_req *)(uintptr_t)cqe->user_data;
+            ssize_t ret = cqe->res < 0 ? -1 : cqe->res;
+
+            head++;
+            __atomic_store_n(uring.cq_head, head, __ATOMIC_RELEASE);
+            blk_complete(req, ret);
+        }
+    }
+
+    return NULL;
+}
+
+static int uring_init(void)
+{
+    struct io_uring_params p;
+    size_t sq_size, cq_size;
+    uint8_t *sq, *cq;
+    sigset_t all, old;
+
+    memset(&p, 0, sizeof p);
+    uring.fd = syscall(__NR_io_uring_setup, UKVM_BLKRING_ENTRIES, &p);
+    if (uring.fd == -1)
+        return -1;
+
+    sq_size = p.sq_off.array + p.sq_entries * sizeof (unsigned);
+    cq_size = p.cq_off.cqes + p.cq_entries * sizeof (struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        if (cq_size > sq_size)
+            sq_size = cq_size;
+        cq_size = sq_size;
+    }
+    sq = mmap(NULL, sq_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE, uring.fd, IORING_OFF_SQ_RING);
+    if (sq == MAP_FAILED)
+        goto fail;
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+        cq = sq;
+    else {
+        cq = mmap(NULL, cq_size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_POPULATE, uring.fd, IORING_OFF_CQ_RING);
+        if (cq == MAP_FAILED)
+            goto fail;
+    }
+    uring.sqes = mmap(NULL, p.sq_entries * sizeof (struct io_uring_sqe),
+            PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring.fd,
+            IORING_OFF_SQES);
+    if (uring.sqes == MAP_FAILED)
+        goto fail;
+
+    uring.sq_tail = (unsigned *)(sq + p.sq_off.tail);
+    uring.sq_mask = (unsigned *)(sq + p.sq_off.ring_mask);
+    uring.sq_array = (unsigned *)(sq + p.sq_off.array);
+    uring.cq_head = (unsigned *)(cq + p.cq_off.head);
+    uring.cq_tail = (unsigned *)(cq + p.cq_off.tail);
+    uring.cq_mask = (unsigned *)(cq + p.cq_off.ring_mask);
+    uring.cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+
+    /*
+     * Signals must continue to be delivered to the VCPU thread only.
+     */
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+    if (pthread_create(&uring.thread, NULL, uring_thread_fn, NULL) != 0)
+        errx(1, "Could not create block I/O completion thread");
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    return 0;
+
+fail:
+    /*
+     * Mappings made so far are left in place; they are unused and small.
+     */
+    close(uring.fd);
+    return -1;
+}
+
+/*
+ * At most UKVM_BLKRING_ENTRIES requests are in flight, and the io_uring
+ * queues are at least that large, so they can never overflow.
+ */
+static void uring_submit(struct blk_req *req)
+{
+    unsigned tail = *uring.sq_tail;
+    unsigned idx = tail & *uring.sq_mask;
+    struct io_uring_sqe *sqe = &uring.sqes[idx];
+
+    memset(sqe, 0, sizeof *sqe);
+    sqe->fd = req->disk->fd;
+    sqe->user_data = (uintptr_t)req;
+    if (req->op == UKVM_BLK_OP_FLUSH) {
+        sqe->opcode = IORING_OP_FSYNC;
+        sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+    }
+    else {
+        sqe->opcode = req->op == UKVM_BLK_OP_WRITE ?
+            IORING_OP_WRITEV : IORING_OP_READV;
+        sqe->off = req->pos;
+        sqe->addr = (uintptr_t)&req->iov;
+        sqe->len = 1;
+    }
+    uring.sq_array[idx] = idx;
+    __atomic_store_n(uring.sq_tail, tail + 1, __ATOMIC_RELEASE);
+    uring.pending++;
+}
+
+static void uring_start(void)
+{
+    while (uring.pending) {
+        int ret = uring_enter(uring.pending, 0, 0);
+
+        if (ret == -1) {
+            if (errno == EINTR)
+                continue;
+            err(1, "io_uring_enter");
+        }
+        uring.pending -= ret;
+    }
+}
+
+static struct blk_engine uring_engine = {
+    .name = "io_uring",
+    .init = uring_init,
+    .submit = uring_submit,
+    .start = uring_start
+};
+
+#endif /* UKVM_BLK_URING */
@@ -29,6 +29,7 @@
 #include <assert.h>
 #include <err.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <poll.h>
 #include <signal.h>
 #include <stdint.h>
@@ -36,6 +37,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -71,6 +73,66 @@ int ukvm_core_register_hypercall(int nr, ukvm_hypercall_fn_t fn)
     return 0;
 }
 
+/*
+ * Until --stats is set up, counters are accumulated in (stats_private) and
+ * not exported.
+ */
+static struct ukvm_stats stats_private;
+struct ukvm_stats *ukvm_stats = &stats_private;
+int ukvm_stats_enabled = 0;
+static const char *stats_path;
+
+uint64_t ukvm_stats_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000000ULL) + ts.tv_nsec;
+}
+
+/*
+ * Set if either --stats or --trace is in use, so that the common case costs
+ * a single branch.
+ */
+static int instrumented = 0;
+static const char *trace_path;
+static const char *profile_arg;
+
+static void hypercall_instrumented(struct ukvm_hv *hv, int nr,
+        ukvm_hypercall_fn_t fn, ukvm_gpa_t gpa)
+{
+    uint64_t ta = 0, tb, ca = 0;
+
+    if (ukvm_trace_enabled)
+        ca = ukvm_trace_cycles();
+    if (ukvm_stats_enabled)
+        ta = ukvm_stats_now();
+    fn(hv, gpa);
+    if (ukvm_stats_enabled) {
+        tb = ukvm_stats_now();
+        ukvm_stats->hypercall_nsecs[nr] += tb - ta;
+        ukvm_stats->hypercall_total_nsecs += tb - ta;
+    }
+    if (ukvm_trace_enabled)
+        ukvm_trace_hypercall(nr, ca, ukvm_trace_cycles());
+}
+
+void ukvm_core_hypercall(struct ukvm_hv *hv, int nr, ukvm_gpa_t gpa)
+{
+    ukvm_hypercall_fn_t fn = NULL;
+
+    if (nr >= 0 && nr < UKVM_HYPERCALL_MAX)
+        fn = ukvm_core_hypercalls[nr];
+    if (fn == NULL)
+        errx(1, "Invalid guest hypercall: num=%d", nr);
+
+    ukvm_stats->hypercalls[nr]++;
+    if (__builtin_expect(instrumented, 0))
+        hypercall_instrumented(hv, nr, fn, gpa);
+    else
+        fn(hv, gpa);
+}
+
 ukvm_vmexit_fn_t ukvm_core_vmexits[NUM_MODULES + 1] = { 0 };
 static int nvmexits = 0;
 
@@ -103,21 +165,39 @@ static void hypercall_puts(struct ukvm_hv *hv, ukvm_gpa_t gpa)
     assert(rc >= 0);
 }
 
-static struct pollfd pollfds[NUM_MODULES];
+/*
+ * Modules may register more than one fd, e.g. one per network queue.
+ */
+#define MAX_POLLFDS 16
+static struct pollfd pollfds[MAX_POLLFDS];
+static ukvm_pollfd_fn_t pollfns[MAX_POLLFDS];
 static int npollfds = 0;
 static sigset_t pollsigmask;
 
 int ukvm_core_register_pollfd(int fd)
 {
-    if (npollfds == NUM_MODULES)
+    if (npollfds == MAX_POLLFDS)
         return -1;
 
     pollfds[npollfds].fd = fd;
     pollfds[npollfds].events = POLLIN;
+    pollfns[npollfds] = NULL;
     npollfds++;
     return 0;
 }
 
+int ukvm_core_replace_pollfd(int oldfd, int newfd, ukvm_pollfd_fn_t fn)
+{
+    for (int i = 0; i < npollfds; i++) {
+        if (pollfds[i].fd == oldfd) {
+            pollfds[i].fd = newfd;
+            pollfns[i] = fn;
+            return 0;
+        }
+    }
+    return -1;
+}
+
 static void hypercall_poll(struct ukvm_hv *hv, ukvm_gpa_t gpa)
 {
     struct ukvm_poll *t =
@@ -128,11 +208,60 @@ static void hypercall_poll(struct ukvm_hv *hv, ukvm_gpa_t gpa)
     ts.tv_sec = t->timeout_nsecs / 1000000000ULL;
     ts.tv_nsec = t->timeout_nsecs % 1000000000ULL;
 
-    rc = ppoll(pollfds, npollfds, &ts, &pollsigmask);
+    if (ukvm_stats_enabled) {
+        uint64_t ta = ukvm_stats_now();
+
+        rc = ppoll(pollfds, npollfds, &ts, &pollsigmask);
+        ukvm_stats->poll_nsecs += ukvm_stats_now() - ta;
+    }
+    else
+        rc = ppoll(pollfds, npollfds, &ts, &pollsigmask);
     assert(rc >= 0);
+    for (int i = 0; rc > 0 && i < npollfds; i++) {
+        if (pollfns[i] && (pollfds[i].revents & POLLIN))
+            pollfns[i](pollfds[i].fd);
+    }
     t->ret = rc;
 }
 
+/*
+ * Create the statistics segment at (path), usually a file under /dev/shm,
+ * and start exporting statistics to it.
+ */
+static void stats_init(const char *path)
+{
+    struct ukvm_stats *s;
+    int fd;
+
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1)
+        err(1, "Could not open statistics file: %s", path);
+    if (ftruncate(fd, sizeof (struct ukvm_stats)) == -1)
+        err(1, "Could not size statistics file: %s", path);
+    s = mmap(NULL, sizeof (struct ukvm_stats), PROT_READ | PROT_WRITE,
+            MAP_SHARED, fd, 0);
+    if (s == MAP_FAILED)
+        err(1, "Could not map statistics file: %s", path);
+    close(fd);
+
+    memcpy(s, ukvm_stats, sizeof (struct ukvm_stats));
+    s->version = UKVM_STATS_VERSION;
+    s->pid = getpid();
+#if defined(__linux__)
+    strcpy(s->hv, "kvm");
+#elif defined(__FreeBSD__)
+    strcpy(s->hv, "vmm");
+#endif
+    s->start_nsecs = ukvm_stats_now();
+    /*
+     * The magic is written last, so that a reader never sees a partially
+     * initialised segment.
+     */
+    __atomic_store_n(&s->magic, UKVM_STATS_MAGIC, __ATOMIC_RELEASE);
+    ukvm_stats = s;
+    ukvm_stats_enabled = 1;
+}
+
 static int setup(struct ukvm_hv *hv)
 {
     assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_WALLTIME,
@@ -141,6 +270,8 @@ static int setup(struct ukvm_hv *hv)
                 hypercall_puts) == 0);
     assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_POLL,
                 hypercall_poll) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_SNAPSHOT,
+                ukvm_snapshot_hypercall) == 0);
 
     /*
      * XXX: This needs documenting / coordination with the top-level caller.
@@ -149,10 +280,42 @@ static int setup(struct ukvm_hv *hv)
     sigdelset(&pollsigmask, SIGTERM);
     sigdelset(&pollsigmask, SIGINT);
 
+    assert(UKVM_HYPERCALL_MAX <= UKVM_STATS_HYPERCALLS);
+    if (stats_path)
+        stats_init(stats_path);
+    if (trace_path)
+        ukvm_trace_init(trace_path);
+    instrumented = ukvm_stats_enabled || ukvm_trace_enabled;
+    if (profile_arg)
+        ukvm_profile_init(hv, profile_arg);
+
     return 0;
 }
 
+static int handle_cmdarg(char *cmdarg)
+{
+    if (!strncmp("--stats=", cmdarg, 8)) {
+        stats_path = cmdarg + 8;
+        return 0;
+    }
+    else if (!strncmp("--trace=", cmdarg, 8)) {
+        trace_path = cmdarg + 8;
+        return 0;
+    }
+    else if (!strncmp("--profile=", cmdarg, 10)) {
+        profile_arg = cmdarg + 10;
+        return 0;
+    }
+    else if (!strncmp("--snapshot=", cmdarg, 11)) {
+        ukvm_snapshot_init(cmdarg + 11);
+        return 0;
+    }
+    else
+        return -1;
+}
+
 struct ukvm_module ukvm_module_core = {
     .name = "core",
-    .setup = setup
+    .setup = setup,
+    .handle_cmdarg = handle_cmdarg
 };
@@ -37,35 +37,91 @@ void ukvm_x86_mem_size(size_t *mem_size) {
     assert (mem <= *mem_size);
     if (mem < *mem_size)
         warnx("adjusting memory to %zu bytes", mem);
-    if (mem > X86_GUEST_PAGE_SIZE * 512)
-        err(1, "guest memory size %zu bytes exceeds the max size %u bytes",
-            mem, X86_GUEST_PAGE_SIZE * 512);
+    if (mem > X86_GUEST_MAX_SIZE)
+        errx(1, "guest memory size %zu bytes exceeds the max size %llu bytes",
+            mem, X86_GUEST_MAX_SIZE);
     *mem_size = mem;
 }
 
-void ukvm_x86_setup_pagetables(uint8_t *mem, size_t mem_size)
+void ukvm_x86_setup_pagetables(uint8_t *mem, size_t mem_size, int gbpages)
 {
     uint64_t *pml4 = (uint64_t *)(mem + X86_PML4_BASE);
     uint64_t *pdpte = (uint64_t *)(mem + X86_PDPTE_BASE);
-    uint64_t *pde = (uint64_t *)(mem + X86_PDE_BASE);
-    uint64_t paddr;
+    uint64_t *pde;
+    uint64_t paddr, end, pd, next_pd = X86_PDE_MEM_BASE;
 
     /*
-     * For simplicity we currently use 2MB pages and only a single
-     * PML4/PDPTE/PDE.  Sanity check that the guest size is a multiple of the
-     * page size and will fit in a single PDE (512 entries).
+     * Guest memory is identity mapped by a single PML4/PDPTE, using a 1GB
+     * page for each whole 1GB if (gbpages) is set, i.e. the guest CPU
+     * supports them, and 2MB pages otherwise. The PDE for the first 1GB is
+     * at X86_PDE_BASE, and those for any further 1GB are allocated from
+     * X86_PDE_MEM_BASE.
      */
     assert((mem_size & (X86_GUEST_PAGE_SIZE - 1)) == 0);
-    assert(mem_size <= (X86_GUEST_PAGE_SIZE * 512));
+    assert(mem_size <= X86_GUEST_MAX_SIZE);
 
     memset(pml4, 0, X86_PML4_SIZE);
     memset(pdpte, 0, X86_PDPTE_SIZE);
-    memset(pde, 0, X86_PDE_SIZE);
 
     *pml4 = X86_PDPTE_BASE | (X86_PDPT_P | X86_PDPT_RW);
-    *pdpte = X86_PDE_BASE | (X86_PDPT_P | X86_PDPT_RW);
-    for (paddr = 0; paddr < mem_size; paddr += X86_GUEST_PAGE_SIZE, pde++)
-        *pde = paddr | (X86_PDPT_P | X86_PDPT_RW | X86_PDPT_PS);
+    for (paddr = 0; paddr < mem_size; paddr = end) {
+        end = paddr + (1ULL << 30);
+        if (gbpages && end <= mem_size) {
+            pdpte[paddr >> 30] = paddr | (X86_PDPT_P | X86_PDPT_RW |
+                    X86_PDPT_PS);
+            continue;
+        }
+        if (end > mem_size)
+            end = mem_size;
+
+        if (paddr == 0)
+            pd = X86_PDE_BASE;
+        else {
+            pd = next_pd;
+            next_pd += X86_PDE_SIZE;
+            assert(next_pd <= X86_PDE_MEM_BASE + X86_PDE_MEM_SIZE);
+        }
+        pde = (uint64_t *)(mem + pd);
+        memset(pde, 0, X86_PDE_SIZE);
+        pdpte[paddr >> 30] = pd | (X86_PDPT_P | X86_PDPT_RW);
+        for (; paddr < end; paddr += X86_GUEST_PAGE_SIZE, pde++)
+            *pde = paddr | (X86_PDPT_P | X86_PDPT_RW | X86_PDPT_PS);
+    }
+}
+
+/*
+ * Map (len) bytes at (gpa), which must be 2MB aligned, read-only using 2MB
+ * pages. PDEs for regions outside the first 1GB are allocated from the pool at
+ * X86_PDE_POOL_BASE. Returns 0 on success, -1 if the pool is exhausted or
+ * (gpa, len) is beyond the guest-physical address space mapped by the PDPTE.
+ */
+int ukvm_x86_map_readonly(uint8_t *mem, uint64_t gpa, uint64_t len)
+{
+    static size_t pool_used;
+    uint64_t *pdpte = (uint64_t *)(mem + X86_PDPTE_BASE);
+    uint64_t *pde;
+    uint64_t paddr, pd;
+
+    assert((gpa & (X86_GUEST_PAGE_SIZE - 1)) == 0);
+    if (gpa + len > X86_PDPTE_SPAN)
+        return -1;
+
+    for (paddr = gpa; paddr < gpa + len; paddr += X86_GUEST_PAGE_SIZE) {
+        pd = pdpte[paddr >> 30];
+        if (!(pd & X86_PDPT_P)) {
+            if (pool_used == X86_PDE_POOL_SIZE)
+                return -1;
+            pd = X86_PDE_POOL_BASE + pool_used;
+            pool_used += X86_PDE_SIZE;
+            memset(mem + pd, 0, X86_PDE_SIZE);
+            pdpte[paddr >> 30] = pd | (X86_PDPT_P | X86_PDPT_RW);
+        }
+        else if (pd & X86_PDPT_PS)
+            return -1;
+        pde = (uint64_t *)(mem + (pd & ~0xfffULL));
+        pde[(paddr >> 21) & 511] = paddr | (X86_PDPT_P | X86_PDPT_PS);
+    }
+    return 0;
 }
 
 static struct x86_gdt_desc sreg_to_desc(const struct x86_sreg *sreg)
@@ -200,10 +200,22 @@ static const struct x86_sreg ukvm_x86_sreg_unusable = {
 #define X86_BOOT_INFO_SIZE      0x1000
 #define X86_CMDLINE_BASE        0x6000
 #define X86_CMDLINE_SIZE        0x2000
-#define X86_GUEST_MIN_BASE      0x8000
+#define X86_PDE_POOL_BASE       0x8000
+#define X86_PDE_POOL_SIZE       0x8000
+#define X86_PDE_MEM_BASE        0x10000
+#define X86_PDE_MEM_SIZE        0xf0000
+#define X86_GUEST_MIN_BASE      0x100000
 
 #define X86_GUEST_PAGE_SIZE     0x200000
 
+/*
+ * Guest memory is mapped by a single PDPTE, covering X86_PDPTE_SPAN. With 2MB
+ * pages each 1GB after the first needs a PDE from X86_PDE_MEM_BASE, which
+ * limits the guest memory size to X86_GUEST_MAX_SIZE.
+ */
+#define X86_PDPTE_SPAN          (512ULL << 30)
+#define X86_GUEST_MAX_SIZE      ((1ULL + X86_PDE_MEM_SIZE / X86_PDE_SIZE) << 30)
+
 #define X86_CR3_INIT            X86_PML4_BASE
 
 /*
@@ -212,7 +224,8 @@ static const struct x86_sreg ukvm_x86_sreg_unusable = {
 #define X86_RFLAGS_INIT         0x2
 
 void ukvm_x86_mem_size(size_t *mem_size);
-void ukvm_x86_setup_pagetables(uint8_t *mem, size_t mem_size);
+void ukvm_x86_setup_pagetables(uint8_t *mem, size_t mem_size, int gbpages);
+int ukvm_x86_map_readonly(uint8_t *mem, uint64_t gpa, uint64_t len);
 void ukvm_x86_setup_gdt(uint8_t *mem);
 
 #endif /* UKVM_CPU_X86_64_H */
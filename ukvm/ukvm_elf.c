@@ -71,6 +71,54 @@ static ssize_t pread_in_full(int fd, void *buf, size_t count, off_t offset)
     return total;
 }
 
+/*
+ * Path of the binary loaded by ukvm_elf_load(), for ukvm_elf_load_symbols().
+ */
+static const char *elf_file;
+
+/*
+ * Protections of the segments loaded by ukvm_elf_load(), for
+ * ukvm_elf_protect().
+ */
+struct elf_prot {
+    uint64_t paddr;
+    uint64_t len;
+    int prot;
+};
+static struct elf_prot *elf_prots;
+static size_t elf_nprots;
+
+/*
+ * Returns the length to map of the segment phdr[ph_i], or 0 if it must be
+ * copied. Only read-only segments without a BSS part can be mapped, if they
+ * are page aligned both in the file and in memory, and no other segment
+ * shares any of their pages.
+ */
+static size_t segment_map_len(const Elf64_Phdr *phdr, Elf64_Half ph_cnt,
+        Elf64_Half ph_i, size_t mem_size, off_t file_size)
+{
+    const Elf64_Phdr *ph = &phdr[ph_i];
+    uint64_t page = sysconf(_SC_PAGESIZE);
+    uint64_t len = (ph->p_filesz + page - 1) & -page;
+    Elf64_Half i;
+
+    if ((ph->p_flags & PF_W) || ph->p_filesz == 0 ||
+            ph->p_filesz != ph->p_memsz ||
+            (ph->p_paddr & (page - 1)) || (ph->p_offset & (page - 1)))
+        return 0;
+    if (ph->p_paddr + len > mem_size ||
+            ph->p_offset + ph->p_filesz > (uint64_t)file_size)
+        return 0;
+    for (i = 0; i < ph_cnt; i++) {
+        if (i == ph_i || phdr[i].p_type != PT_LOAD)
+            continue;
+        if (phdr[i].p_paddr < ph->p_paddr + len &&
+                phdr[i].p_paddr + phdr[i].p_memsz > ph->p_paddr)
+            return 0;
+    }
+    return len;
+}
+
 /*
  * Load code from elf file into *mem and return the elf entry point
  * and the last byte of the program when loaded into memory. This
@@ -86,11 +134,16 @@ static ssize_t pread_in_full(int fd, void *buf, size_t count, off_t offset)
  *   |             |        code        |   00000000000  |
  *   |             |  [PROT_EXEC|READ]  |                |
  *
+ * If (map) is set, read-only segments are mapped from the file where
+ * possible (see segment_map_len()) rather than copied. Their pages are then
+ * read in when the guest first touches them, and shared through the page cache
+ * with other guests running the same binary.
  */
-void ukvm_elf_load(const char *file, uint8_t *mem, size_t mem_size,
+void ukvm_elf_load(const char *file, uint8_t *mem, size_t mem_size, int map,
        ukvm_gpa_t *p_entry, ukvm_gpa_t *p_end)
 {
     int fd_kernel;
+    struct stat st;
     ssize_t numb;
     size_t buflen;
     Elf64_Off ph_off;
@@ -108,6 +161,8 @@ void ukvm_elf_load(const char *file, uint8_t *mem, size_t mem_size,
     fd_kernel = open(file, O_RDONLY);
     if (fd_kernel == -1)
         goto out_error;
+    if (fstat(fd_kernel, &st) == -1)
+        goto out_error;
 
     numb = pread_in_full(fd_kernel, &hdr, sizeof(Elf64_Ehdr), 0);
     if (numb < 0)
@@ -151,6 +206,11 @@ void ukvm_elf_load(const char *file, uint8_t *mem, size_t mem_size,
         goto out_error;
     if (numb != buflen)
         goto out_invalid;
+    free(elf_prots);
+    elf_prots = calloc(ph_cnt, sizeof *elf_prots);
+    if (ph_cnt && !elf_prots)
+        goto out_error;
+    elf_nprots = 0;
 
     /*
      * Load all segments with the LOAD directive from the elf file at offset
@@ -167,6 +227,7 @@ void ukvm_elf_load(const char *file, uint8_t *mem, size_t mem_size,
         uint64_t paddr = phdr[ph_i].p_paddr;
         uint64_t align = phdr[ph_i].p_align;
         uint64_t result;
+        size_t maplen;
         int prot;
 
         if (phdr[ph_i].p_type != PT_LOAD)
@@ -192,14 +253,6 @@ void ukvm_elf_load(const char *file, uint8_t *mem, size_t mem_size,
         if (_end > *p_end)
             *p_end = _end;
 
-        daddr = mem + paddr;
-        numb = pread_in_full(fd_kernel, daddr, filesz, offset);
-        if (numb < 0)
-            goto out_error;
-        if (numb != filesz)
-            goto out_invalid;
-        memset(daddr + filesz, 0, memsz - filesz);
-
         prot = PROT_NONE;
         if (phdr[ph_i].p_flags & PF_R)
             prot |= PROT_READ;
@@ -210,13 +263,50 @@ void ukvm_elf_load(const char *file, uint8_t *mem, size_t mem_size,
         if (prot & PROT_WRITE && prot & PROT_EXEC)
             warnx("%s: Warning: phdr[%u] requests WRITE and EXEC permissions",
                   file, ph_i);
-        if (mprotect(daddr, _end - paddr, prot) == -1)
-            goto out_error;
+
+        daddr = mem + paddr;
+        maplen = map ? segment_map_len(phdr, ph_cnt, ph_i, mem_size,
+                st.st_size) : 0;
+        /*
+         * The guest may use the memory after (_end), e.g. for its heap.
+         */
+        if (maplen > _end - paddr)
+            maplen = 0;
+        if (maplen) {
+            if (mmap(daddr, maplen, prot, MAP_PRIVATE | MAP_FIXED, fd_kernel,
+                        offset) == MAP_FAILED)
+                goto out_error;
+        }
+        else {
+            numb = pread_in_full(fd_kernel, daddr, filesz, offset);
+            if (numb < 0)
+                goto out_error;
+            if (numb != filesz)
+                goto out_invalid;
+            memset(daddr + filesz, 0, memsz - filesz);
+        }
+
+        if (mprotect(daddr, _end - paddr, prot) == -1) {
+            /*
+             * Guest memory backed by hugetlbfs (--mem-hugepages) can only be
+             * protected in units of huge pages.
+             */
+            if (errno != EINVAL || ukvm_hugepages == UKVM_HUGEPAGES_NONE)
+                goto out_error;
+            warnx("%s: Warning: phdr[%u] is not protected in huge pages",
+                    file, ph_i);
+        }
+        elf_prots[elf_nprots].paddr = paddr;
+        elf_prots[elf_nprots].len = _end - paddr;
+        elf_prots[elf_nprots].prot = prot;
+        elf_nprots++;
     }
 
+    /* Mapped segments keep their own reference to the file. */
     free (phdr);
     close (fd_kernel);
     *p_entry = hdr.e_entry;
+    elf_file = file;
     return;
 
 out_error:
@@ -225,3 +315,110 @@ out_error:
 out_invalid:
     errx(1, "%s: Exec format error", file);
 }
+
+void ukvm_elf_protect(uint8_t *mem)
+{
+    size_t i;
+
+    for (i = 0; i < elf_nprots; i++) {
+        if (mprotect(mem + elf_prots[i].paddr, elf_prots[i].len,
+                    elf_prots[i].prot) == -1 &&
+                (errno != EINVAL || ukvm_hugepages == UKVM_HUGEPAGES_NONE))
+            err(1, "%s", elf_file);
+    }
+}
+
+static int sym_compare(const void *a, const void *b)
+{
+    const struct ukvm_elf_sym *sa = a, *sb = b;
+
+    return (sa->addr > sb->addr) - (sa->addr < sb->addr);
+}
+
+int ukvm_elf_load_symbols(struct ukvm_elf_sym **syms, size_t *nsyms)
+{
+    int fd = -1;
+    Elf64_Ehdr hdr;
+    Elf64_Shdr *shdr = NULL;
+    Elf64_Sym *symtab = NULL;
+    char *strtab = NULL;
+    struct ukvm_elf_sym *out = NULL;
+    size_t buflen, nsym, n = 0;
+    Elf64_Half sh_i;
+
+    if (elf_file == NULL)
+        return -1;
+    fd = open(elf_file, O_RDONLY);
+    if (fd == -1)
+        goto out_error;
+    if (pread_in_full(fd, &hdr, sizeof hdr, 0) != sizeof hdr)
+        goto out_invalid;
+    if (hdr.e_shentsize != sizeof (Elf64_Shdr) || hdr.e_shnum == 0)
+        goto out_invalid;
+
+    buflen = hdr.e_shnum * sizeof (Elf64_Shdr);
+    shdr = malloc(buflen);
+    if (shdr == NULL)
+        goto out_error;
+    if (pread_in_full(fd, shdr, buflen, hdr.e_shoff) != buflen)
+        goto out_invalid;
+
+    for (sh_i = 0; sh_i < hdr.e_shnum; sh_i++) {
+        if (shdr[sh_i].sh_type == SHT_SYMTAB)
+            break;
+    }
+    if (sh_i == hdr.e_shnum || shdr[sh_i].sh_link >= hdr.e_shnum ||
+            shdr[sh_i].sh_entsize != sizeof (Elf64_Sym))
+        goto out_invalid;
+
+    Elf64_Shdr *ssym = &shdr[sh_i], *sstr = &shdr[ssym->sh_link];
+    symtab = malloc(ssym->sh_size);
+    strtab = malloc(sstr->sh_size + 1);
+    if (symtab == NULL || strtab == NULL)
+        goto out_error;
+    if (pread_in_full(fd, symtab, ssym->sh_size, ssym->sh_offset) !=
+            ssym->sh_size)
+        goto out_invalid;
+    if (pread_in_full(fd, strtab, sstr->sh_size, sstr->sh_offset) !=
+            sstr->sh_size)
+        goto out_invalid;
+    strtab[sstr->sh_size] = '\0';
+
+    nsym = ssym->sh_size / sizeof (Elf64_Sym);
+    out = malloc(nsym * sizeof (struct ukvm_elf_sym));
+    if (out == NULL)
+        goto out_error;
+    for (size_t i = 0; i < nsym; i++) {
+        if (ELF64_ST_TYPE(symtab[i].st_info) != STT_FUNC ||
+                symtab[i].st_value == 0 ||
+                symtab[i].st_name >= sstr->sh_size)
+            continue;
+        out[n].addr = symtab[i].st_value;
+        out[n].size = symtab[i].st_size;
+        out[n].name = strtab + symtab[i].st_name;
+        n++;
+    }
+    qsort(out, n, sizeof (struct ukvm_elf_sym), sym_compare);
+
+    /* (strtab) is referenced by the returned symbols. */
+    free(symtab);
+    free(shdr);
+    close(fd);
+    *syms = out;
+    *nsyms = n;
+    return 0;
+
+out_error:
+    warn("%s", elf_file);
+    goto out;
+out_invalid:
+    warnx("%s: No usable symbol table", elf_file);
+out:
+    free(out);
+    free(strtab);
+    free(symtab);
+    free(shdr);
+    if (fd != -1)
+        close(fd);
+    return -1;
+}
@@ -54,20 +54,18 @@ struct ukvm_cpu_boot_info {
 typedef uint64_t ukvm_gpa_t;
 #    else
 /*
- * On x86, 32-bit PIO is used as the hypercall mechanism. This only supports
- * sending 32-bit pointers; raise an assertion if a bigger pointer is used.
+ * On x86, 32-bit PIO is used as the hypercall mechanism. The pointer is passed
+ * in full in RAX, of which the PIO only carries the lower 32 bits; for guests
+ * with more than 4GB of memory the monitor reads the upper 32 bits from RAX.
  *
  * On x86 the compiler-only memory barrier ("memory" clobber) is sufficient
  * across the hypercall boundary.
  */
 static inline void ukvm_do_hypercall(int n, volatile void *arg)
 {
-#    ifdef assert
-    assert(((uint64_t)arg <= UINT32_MAX));
-#    endif
-    __asm__ __volatile__("outl %0, %1"
+    __asm__ __volatile__("outl %%eax, %1"
             :
-            : "a" ((uint32_t)((uint64_t)arg)),
+            : "a" ((uint64_t)arg),
               "d" ((uint16_t)(UKVM_HYPERCALL_PIO_BASE + n))
             : "memory");
 }
@@ -170,6 +168,19 @@ enum ukvm_hypercall {
     UKVM_HYPERCALL_NETWRITE,
     UKVM_HYPERCALL_NETREAD,
     UKVM_HYPERCALL_HALT,
+    UKVM_HYPERCALL_NETWRITEV,
+    UKVM_HYPERCALL_NETREADV,
+    UKVM_HYPERCALL_NETRINGS,
+    UKVM_HYPERCALL_NETKICK,
+    UKVM_HYPERCALL_BLKWRITEV,
+    UKVM_HYPERCALL_BLKREADV,
+    UKVM_HYPERCALL_BLKRING,
+    UKVM_HYPERCALL_BLKSUBMIT,
+    UKVM_HYPERCALL_BLKFLUSH,
+    UKVM_HYPERCALL_BLKDISCARD,
+    UKVM_HYPERCALL_BLKWRITEZEROES,
+    UKVM_HYPERCALL_BLKOPEN,
+    UKVM_HYPERCALL_SNAPSHOT,
     UKVM_HYPERCALL_MAX
 };
 
@@ -190,17 +201,43 @@ struct ukvm_puts {
     size_t len;
 };
 
-/* UKVM_HYPERCALL_BLKINFO */
+/*
+ * Block devices are identified by a (handle), as returned by
+ * UKVM_HYPERCALL_BLKOPEN. Handle 0 is the default device, i.e. the first one
+ * given to the monitor.
+ */
+#define UKVM_BLK_MAX            8
+#define UKVM_BLK_NAME_MAX       16      /* Including the terminating NUL */
+
+/* UKVM_HYPERCALL_BLKOPEN */
+struct ukvm_blkopen {
+    /* IN */
+    char name[UKVM_BLK_NAME_MAX];
+
+    /* OUT */
+    int handle;
+    int ret;
+};
+
+/*
+ * UKVM_HYPERCALL_BLKINFO. All fields are returned as 0 if (handle) is not
+ * valid.
+ */
 struct ukvm_blkinfo {
+    /* IN */
+    int handle;
+
     /* OUT */
     size_t sector_size;
     size_t num_sectors;
     int rw;
+    UKVM_GUEST_PTR(const void *) map;   /* Read-only disk mapping, or 0 */
 };
 
 /* UKVM_HYPERCALL_BLKWRITE */
 struct ukvm_blkwrite {
     /* IN */
+    int handle;
     size_t sector;
     UKVM_GUEST_PTR(const void *) data;
     size_t len;
@@ -212,6 +249,7 @@ struct ukvm_blkwrite {
 /* UKVM_HYPERCALL_BLKREAD */
 struct ukvm_blkread {
     /* IN */
+    int handle;
     size_t sector;
     UKVM_GUEST_PTR(void *) data;
 
@@ -222,10 +260,211 @@ struct ukvm_blkread {
     int ret;
 };
 
+/*
+ * Maximum number of segments which can be passed in a single
+ * UKVM_HYPERCALL_BLKWRITEV or UKVM_HYPERCALL_BLKREADV.
+ */
+#define UKVM_BLKSEG_MAX 64
+
+/*
+ * Segment descriptor used by UKVM_HYPERCALL_BLKWRITEV and
+ * UKVM_HYPERCALL_BLKREADV: (len) bytes at (data), starting at (sector).
+ */
+struct ukvm_blkseg {
+    size_t sector;
+    UKVM_GUEST_PTR(void *) data;
+    size_t len;
+};
+
+/*
+ * UKVM_HYPERCALL_BLKWRITEV and UKVM_HYPERCALL_BLKREADV: Transfer all (nsegs)
+ * segments. If any segment is out of range, no I/O is done and (ret) is -1.
+ */
+struct ukvm_blkwritev {
+    /* IN */
+    int handle;
+    UKVM_GUEST_PTR(const struct ukvm_blkseg *) segs;
+    size_t nsegs;
+
+    /* OUT */
+    int ret;
+};
+
+struct ukvm_blkreadv {
+    /* IN */
+    int handle;
+    UKVM_GUEST_PTR(const struct ukvm_blkseg *) segs;
+    size_t nsegs;
+
+    /* OUT */
+    int ret;
+};
+
+/*
+ * UKVM_HYPERCALL_BLKFLUSH: Make all writes which have completed durable.
+ */
+struct ukvm_blkflush {
+    /* IN */
+    int handle;
+
+    /* OUT */
+    int ret;
+};
+
+/*
+ * UKVM_HYPERCALL_BLKDISCARD: Tell the monitor that the contents of
+ * (nsectors) sectors starting at (sector) are no longer needed, so that it
+ * may release the underlying storage. The sectors read back as zeroes or
+ * their previous contents.
+ */
+struct ukvm_blkdiscard {
+    /* IN */
+    int handle;
+    size_t sector;
+    size_t nsectors;
+
+    /* OUT */
+    int ret;
+};
+
+/*
+ * UKVM_HYPERCALL_BLKWRITEZEROES: Set (nsectors) sectors starting at (sector)
+ * to zeroes, without transferring a buffer of zeroes.
+ */
+struct ukvm_blkwritezeroes {
+    /* IN */
+    int handle;
+    size_t sector;
+    size_t nsectors;
+
+    /* OUT */
+    int ret;
+};
+
+/*
+ * Asynchronous block I/O rings.
+ *
+ * The guest queues requests on the submission queue (sq) and issues
+ * UKVM_HYPERCALL_BLKSUBMIT to have the monitor start them. Requests are
+ * serviced by the monitor in the background and may complete in any order;
+ * the completion for each request is posted on the completion queue (cq),
+ * tagged with the (id) of the request.
+ *
+ * Both queues follow the same producer/consumer conventions as the network
+ * rings (see below). The guest must not have more than UKVM_BLKRING_ENTRIES
+ * requests outstanding, counting both requests in flight and completions it
+ * has not yet consumed; the monitor leaves any further requests on the
+ * submission queue.
+ *
+ * The monitor wakes a guest blocked in UKVM_HYPERCALL_POLL after producing on
+ * a completion queue which was empty.
+ */
+#define UKVM_BLKRING_ENTRIES    128
+
+#define UKVM_BLK_OP_READ        0
+#define UKVM_BLK_OP_WRITE       1
+#define UKVM_BLK_OP_FLUSH       2   /* As UKVM_HYPERCALL_BLKFLUSH */
+
+struct ukvm_blksqe {
+    uint64_t id;
+    uint32_t op;
+    uint32_t handle;
+    uint64_t sector;
+    UKVM_GUEST_PTR(void *) data;
+    uint64_t len;
+};
+
+struct ukvm_blkcqe {
+    uint64_t id;
+    int32_t ret;                /* 0 on success, -1 on error */
+    uint32_t reserved;
+};
+
+struct ukvm_blkring {
+    uint32_t sq_prod;
+    uint8_t pad0[60];
+    uint32_t sq_cons;
+    uint8_t pad1[60];
+    uint32_t cq_prod;
+    uint8_t pad2[60];
+    uint32_t cq_cons;
+    uint8_t pad3[60];
+    struct ukvm_blksqe sq[UKVM_BLKRING_ENTRIES];
+    struct ukvm_blkcqe cq[UKVM_BLKRING_ENTRIES];
+};
+
+/*
+ * UKVM_HYPERCALL_BLKRING: Set up asynchronous block I/O using the ring at
+ * (ring), which must be zeroed by the guest before the call. Returns 0 on
+ * success, -1 if asynchronous I/O is not supported or already set up.
+ */
+struct ukvm_blkring_setup {
+    /* IN */
+    UKVM_GUEST_PTR(struct ukvm_blkring *) ring;
+
+    /* OUT */
+    int ret;
+};
+
+/*
+ * UKVM_HYPERCALL_BLKSUBMIT: Start all requests queued on the submission
+ * queue.
+ */
+struct ukvm_blksubmit {
+    /* OUT */
+    int ret;
+};
+
+/*
+ * Network features reported in (struct ukvm_netinfo).features.
+ */
+#define UKVM_NET_F_RINGS        (1U << 0)   /* UKVM_HYPERCALL_NETRINGS */
+#define UKVM_NET_F_CSUM         (1U << 1)   /* Partial checksums (offload) */
+#define UKVM_NET_F_TSO4         (1U << 2)   /* TCP/IPv4 segmentation offload */
+#define UKVM_NET_F_TSO6         (1U << 3)   /* TCP/IPv6 segmentation offload */
+
+/*
+ * Per-frame offload header, laid out as the Linux/virtio struct virtio_net_hdr.
+ * May be passed with UKVM_HYPERCALL_NETWRITE and NETREAD if any of
+ * UKVM_NET_F_{CSUM,TSO4,TSO6} are reported by UKVM_HYPERCALL_NETINFO.
+ *
+ * On NETWRITE, the header describes a frame which still needs a checksum
+ * inserted at (csum_start + csum_offset) and/or must be segmented into
+ * (gso_size) byte payloads. On the first NETREAD with a header, the monitor
+ * enables the same offloads for received frames, so the guest must be
+ * prepared to handle partially checksummed and up to 64kB frames from then
+ * on.
+ */
+#define UKVM_NET_HDR_F_NEEDS_CSUM   1
+#define UKVM_NET_HDR_F_DATA_VALID   2
+#define UKVM_NET_HDR_GSO_NONE       0
+#define UKVM_NET_HDR_GSO_TCPV4      1
+#define UKVM_NET_HDR_GSO_TCPV6      4
+#define UKVM_NET_HDR_GSO_ECN        0x80
+
+struct ukvm_net_hdr {
+    uint8_t flags;
+    uint8_t gso_type;
+    uint16_t hdr_len;
+    uint16_t gso_size;
+    uint16_t csum_start;
+    uint16_t csum_offset;
+};
+
+/*
+ * Maximum number of network queues. With more than one queue, the monitor
+ * always offers UKVM_NET_F_RINGS and the guest must set up rings for every
+ * queue; received flows are steered to a queue by the host, and the guest
+ * should likewise keep each transmitted flow on one queue.
+ */
+#define UKVM_NET_QUEUES_MAX     8
+
 /* UKVM_HYPERCALL_NETINFO */
 struct ukvm_netinfo {
     /* OUT */
     char mac_str[18];
+    uint32_t features;
+    uint32_t nqueues;
 };
 
 /* UKVM_HYPERCALL_NETWRITE */
@@ -233,6 +472,7 @@ struct ukvm_netwrite {
     /* IN */
     UKVM_GUEST_PTR(const void *) data;
     size_t len;
+    UKVM_GUEST_PTR(const struct ukvm_net_hdr *) hdr;    /* Optional */
 
     /* OUT */
     int ret;
@@ -242,6 +482,7 @@ struct ukvm_netwrite {
 struct ukvm_netread {
     /* IN */
     UKVM_GUEST_PTR(void *) data;
+    UKVM_GUEST_PTR(struct ukvm_net_hdr *) hdr;          /* Optional, OUT */
 
     /* IN/OUT */
     size_t len;
@@ -250,6 +491,111 @@ struct ukvm_netread {
     int ret;
 };
 
+/*
+ * Maximum number of frames which can be passed in a single
+ * UKVM_HYPERCALL_NETWRITEV or UKVM_HYPERCALL_NETREADV.
+ */
+#define UKVM_NETIOV_MAX 64
+
+/*
+ * Frame descriptor used by UKVM_HYPERCALL_NETWRITEV and
+ * UKVM_HYPERCALL_NETREADV. Each descriptor describes exactly one frame.
+ */
+struct ukvm_netiov {
+    UKVM_GUEST_PTR(void *) data;
+    size_t len;
+};
+
+/* UKVM_HYPERCALL_NETWRITEV */
+struct ukvm_netwritev {
+    /* IN */
+    UKVM_GUEST_PTR(const struct ukvm_netiov *) iov;
+    size_t iovcnt;
+
+    /* OUT */
+    size_t nframes;
+    int ret;
+};
+
+/*
+ * UKVM_HYPERCALL_NETREADV: Receive up to (iovcnt) frames. On return, (nframes)
+ * descriptors have had their (len) updated to the size of the received frame.
+ */
+struct ukvm_netreadv {
+    /* IN */
+    UKVM_GUEST_PTR(struct ukvm_netiov *) iov;
+    size_t iovcnt;
+
+    /* OUT */
+    size_t nframes;
+    int ret;
+};
+
+/*
+ * Shared-memory frame rings (UKVM_NET_F_RINGS).
+ *
+ * A ring is a single-producer, single-consumer queue of frame slots in guest
+ * memory. The guest produces on the TX ring and consumes from the RX ring; a
+ * host I/O thread in the monitor does the opposite, moving frames between the
+ * rings and the host network device without any VM exits.
+ *
+ * (prod) is only written by the producer and (cons) only by the consumer.
+ * Both are free-running counters; the slot for counter value (i) is
+ * slot[i % UKVM_NETRING_SLOTS]. The ring is empty when (prod == cons) and full
+ * when (prod - cons == UKVM_NETRING_SLOTS).
+ *
+ * A side only needs to notify the other when it may be sleeping:
+ *
+ * - The guest issues UKVM_HYPERCALL_NETKICK after producing on a TX ring which
+ *   was empty, or after consuming from an RX ring which was full.
+ * - The monitor wakes a guest blocked in UKVM_HYPERCALL_POLL after producing
+ *   on an RX ring which was empty.
+ *
+ * Each side must issue a full memory barrier between updating its own counter
+ * and reading the other side's counter to decide whether to notify.
+ */
+#define UKVM_NETRING_SLOTS      256
+#define UKVM_NETRING_FRAME_SIZE 2040
+
+struct ukvm_netring_slot {
+    uint32_t len;
+    uint32_t reserved;
+    uint8_t data[UKVM_NETRING_FRAME_SIZE];
+};
+
+struct ukvm_netring {
+    uint32_t prod;
+    uint8_t pad0[60];
+    uint32_t cons;
+    uint8_t pad1[60];
+    struct ukvm_netring_slot slot[UKVM_NETRING_SLOTS];
+};
+
+/*
+ * UKVM_HYPERCALL_NETRINGS: Switch network queue (queue) to use the
+ * shared-memory rings at (tx) and (rx). Both rings must be zeroed by the guest
+ * before the call. Once set up, UKVM_HYPERCALL_NETWRITE{,V} and NETREAD{,V}
+ * must no longer be used. Returns 0 on success, -1 if rings are not supported.
+ */
+struct ukvm_netrings {
+    /* IN */
+    uint32_t queue;
+    UKVM_GUEST_PTR(struct ukvm_netring *) tx;
+    UKVM_GUEST_PTR(struct ukvm_netring *) rx;
+
+    /* OUT */
+    int ret;
+};
+
+/*
+ * UKVM_HYPERCALL_NETKICK: Notify the monitor of a ring state transition on
+ * network queue (queue) (see above).
+ */
+struct ukvm_netkick {
+    /* IN */
+    uint32_t queue;
+};
+
 /*
  * UKVM_HYPERCALL_POLL: Block until timeout_nsecs have passed or I/O is
  * possible, whichever is sooner. Returns 1 if I/O is possible, otherwise 0.
@@ -264,4 +610,16 @@ struct ukvm_poll {
     int ret;
 };
 
+/*
+ * UKVM_HYPERCALL_SNAPSHOT: Made once by the guest, just before it calls
+ * solo5_app_main(). With --snapshot, the monitor saves the guest to a
+ * snapshot at this point and exits. Instances started from the snapshot with
+ * --restore return from the hypercall with (ret) set to 1; otherwise it is
+ * set to 0.
+ */
+struct ukvm_snapshot {
+    /* OUT */
+    int ret;
+};
+
 #endif /* UKVM_GUEST_H */
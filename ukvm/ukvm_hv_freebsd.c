@@ -108,6 +108,10 @@ struct ukvm_hv *ukvm_hv_init(size_t mem_size)
     if (ret == -1)
 	err(1, "set VM_CAP_HALT_EXIT");
 
+    /*
+     * vmm(4) backs memory segments with superpages where it can, so
+     * --mem-hugepages (ukvm_hugepages) has no further effect here.
+     */
     struct vm_memseg memseg = {
 	.segid = 0, .len = mem_size
     };
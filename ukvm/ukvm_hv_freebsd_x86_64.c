@@ -99,7 +99,8 @@ void ukvm_hv_vcpu_init(struct ukvm_hv *hv, ukvm_gpa_t gpa_ep,
     struct ukvm_hvb *hvb = hv->b;
 
     ukvm_x86_setup_gdt(hv->mem);
-    ukvm_x86_setup_pagetables(hv->mem, hv->mem_size);
+    /* XXX: Use 1GB pages if vmm(4) exposes them to the guest. */
+    ukvm_x86_setup_pagetables(hv->mem, hv->mem_size, 0);
 
     vmm_set_reg(hvb->vmfd, VM_REG_GUEST_CR0, X86_CR0_INIT);
     vmm_set_reg(hvb->vmfd, VM_REG_GUEST_CR3, X86_CR3_INIT);
@@ -164,15 +165,77 @@ static void dump_vmx(struct vm_exit *vme)
     warnx("\tinst_error\t%d", vme->u.vmx.inst_error);
 }
 
+void ukvm_hv_vcpu_kick(struct ukvm_hv *hv __attribute__((unused)))
+{
+    /*
+     * VM_RUN returns EINTR when a signal is pending, so there is nothing
+     * more to do here.
+     */
+}
+
+int ukvm_hv_map_readonly(struct ukvm_hv *hv __attribute__((unused)),
+        void *addr __attribute__((unused)), size_t len __attribute__((unused)),
+        ukvm_gpa_t *gpa __attribute__((unused)))
+{
+    /*
+     * Not implemented.
+     */
+    return -1;
+}
+
+int ukvm_hv_vcpu_save(struct ukvm_hv *hv __attribute__((unused)),
+        void **state __attribute__((unused)),
+        size_t *len __attribute__((unused)))
+{
+    /*
+     * Not implemented.
+     */
+    return -1;
+}
+
+int ukvm_hv_vcpu_restore(struct ukvm_hv *hv __attribute__((unused)),
+        const void *state __attribute__((unused)),
+        size_t len __attribute__((unused)),
+        uint64_t nsecs __attribute__((unused)))
+{
+    /*
+     * Not implemented.
+     */
+    return -1;
+}
+
+int ukvm_hv_vcpu_sample(struct ukvm_hv *hv, uint64_t *pc, uint64_t *fp)
+{
+    struct vm_register rip = { .cpuid = 0, .regnum = VM_REG_GUEST_RIP };
+    struct vm_register rbp = { .cpuid = 0, .regnum = VM_REG_GUEST_RBP };
+
+    if (ioctl(hv->b->vmfd, VM_GET_REGISTER, &rip) == -1 ||
+            ioctl(hv->b->vmfd, VM_GET_REGISTER, &rbp) == -1)
+        return -1;
+    *pc = rip.regval;
+    *fp = rbp.regval;
+    return 0;
+}
+
 void ukvm_hv_vcpu_loop(struct ukvm_hv *hv)
 {
     struct ukvm_hvb *hvb = hv->b;
     int ret;
 
     while (1) {
-        ret = ioctl(hv->b->vmfd, VM_RUN, &hvb->vmrun);
-        if (ret == -1 && errno == EINTR)
+        if (ukvm_stats_enabled) {
+            uint64_t ta = ukvm_stats_now();
+
+            ret = ioctl(hv->b->vmfd, VM_RUN, &hvb->vmrun);
+            ukvm_stats->run_nsecs += ukvm_stats_now() - ta;
+        }
+        else
+            ret = ioctl(hv->b->vmfd, VM_RUN, &hvb->vmrun);
+        if (ret == -1 && errno == EINTR) {
+            if (ukvm_profile_pending)
+                ukvm_profile_sample(hv);
             continue;
+        }
         if (ret == -1) {
             err(1, "VM_RUN");
         }
@@ -185,6 +248,7 @@ void ukvm_hv_vcpu_loop(struct ukvm_hv *hv)
 
         struct vm_exit *vme = &hvb->vmrun.vm_exit;
 
+        UKVM_STATS_EXIT(vme->exitcode);
         switch (vme->exitcode) {
         case VM_EXITCODE_SUSPENDED:
             /* Guest has halted the CPU, this is considered as a normal exit. */
@@ -201,12 +265,20 @@ void ukvm_hv_vcpu_loop(struct ukvm_hv *hv)
                         vme->u.inout.port);
 
             int nr = vme->u.inout.port - UKVM_HYPERCALL_PIO_BASE;
-            ukvm_hypercall_fn_t fn = ukvm_core_hypercalls[nr];
-            if (fn == NULL)
-                errx(1, "Invalid guest hypercall: num=%d", nr);
-
             ukvm_gpa_t gpa = vme->u.inout.eax;
-            fn(hv, gpa);
+            /*
+             * For guests with more than 4GB of memory, the full address is
+             * in RAX.
+             */
+            if (hv->mem_size > (1ULL << 32)) {
+                struct vm_register rax = {
+                    .cpuid = 0, .regnum = VM_REG_GUEST_RAX
+                };
+                if (ioctl(hvb->vmfd, VM_GET_REGISTER, &rax) == -1)
+                    err(1, "VM_GET_REGISTER");
+                gpa = rax.regval;
+            }
+            ukvm_core_hypercall(hv, nr, gpa);
             break;
         }
 
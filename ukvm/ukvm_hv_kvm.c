@@ -26,15 +26,149 @@
 #include <assert.h>
 #include <err.h>
 #include <fcntl.h>
+#include <limits.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <unistd.h>
 #include <linux/kvm.h>
 
 #include "ukvm.h"
 #include "ukvm_hv_kvm.h"
 
+#define HUGEPAGE_SIZE (2 * 1024 * 1024)
+
+/*
+ * Reserve (size) bytes of address space aligned to HUGEPAGE_SIZE, so that
+ * guest 2MB pages line up with host huge pages.
+ */
+static uint8_t *mem_reserve(size_t size)
+{
+    uint8_t *p, *mem;
+
+    p = mmap(NULL, size + HUGEPAGE_SIZE, PROT_NONE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED)
+        err(1, "Error allocating guest memory");
+    mem = (uint8_t *)(((uintptr_t)p + HUGEPAGE_SIZE - 1) &
+            ~(uintptr_t)(HUGEPAGE_SIZE - 1));
+    if (mem > p)
+        munmap(p, mem - p);
+    if (mem < p + HUGEPAGE_SIZE)
+        munmap(mem + size, p + HUGEPAGE_SIZE - mem);
+    return mem;
+}
+
+/*
+ * Allocate guest memory from hugetlbfs, or return NULL if not enough huge
+ * pages are available.
+ */
+static uint8_t *mem_hugetlbfs(size_t size)
+{
+    uint8_t *mem = mem_reserve(size);
+    void *p;
+
+    if (ukvm_hugetlbfs_path == NULL) {
+        p = mmap(mem, size, PROT_READ | PROT_WRITE,
+                MAP_SHARED | MAP_ANONYMOUS | MAP_HUGETLB | MAP_FIXED, -1, 0);
+    }
+    else {
+        char path[PATH_MAX];
+        int fd;
+
+        snprintf(path, sizeof path, "%s/ukvm.XXXXXX", ukvm_hugetlbfs_path);
+        fd = mkstemp(path);
+        if (fd == -1) {
+            warn("Could not create file in %s", ukvm_hugetlbfs_path);
+            p = MAP_FAILED;
+        }
+        else {
+            unlink(path);
+            p = mmap(mem, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+                    fd, 0);
+            close(fd);
+        }
+    }
+    if (p == MAP_FAILED) {
+        munmap(mem, size);
+        return NULL;
+    }
+    return mem;
+}
+
+/*
+ * Allocate guest memory using transparent huge pages, or return NULL if they
+ * are disabled.
+ */
+static uint8_t *mem_thp(size_t size)
+{
+    char buf[64] = { 0 };
+    uint8_t *mem;
+    int fd;
+
+    fd = open("/sys/kernel/mm/transparent_hugepage/enabled", O_RDONLY);
+    if (fd == -1)
+        return NULL;
+    if (read(fd, buf, sizeof buf - 1) == -1)
+        buf[0] = 0;
+    close(fd);
+    if (buf[0] == 0 || strstr(buf, "[never]"))
+        return NULL;
+
+    /*
+     * Shared anonymous memory only gets huge pages if enabled for shmem, so
+     * use private memory.
+     */
+    mem = mem_reserve(size);
+    if (mmap(mem, size, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED)
+        err(1, "Error allocating guest memory");
+    if (madvise(mem, size, MADV_HUGEPAGE) == -1) {
+        munmap(mem, size);
+        return NULL;
+    }
+    return mem;
+}
+
+static uint8_t *mem_alloc(size_t size)
+{
+    uint8_t *mem = NULL;
+
+    switch (ukvm_hugepages) {
+    case UKVM_HUGEPAGES_AUTO:
+        mem = mem_hugetlbfs(size);
+        if (mem == NULL)
+            mem = mem_thp(size);
+        break;
+    case UKVM_HUGEPAGES_THP:
+        mem = mem_thp(size);
+        break;
+    case UKVM_HUGEPAGES_HUGETLBFS:
+        mem = mem_hugetlbfs(size);
+        break;
+    case UKVM_HUGEPAGES_NONE:
+        break;
+    }
+    if (mem)
+        return mem;
+    if (ukvm_hugepages != UKVM_HUGEPAGES_NONE)
+        warnx("Huge pages are not available, using normal pages");
+
+    /*
+     * Guest memory is only populated as the guest touches it, so do not
+     * reserve swap space for all of it up front. This allows guests with more
+     * memory than the host could commit at once.
+     */
+    mem = mmap(NULL, size, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (mem == MAP_FAILED)
+        err(1, "Error allocating guest memory");
+    return mem;
+}
+
 struct ukvm_hv *ukvm_hv_init(size_t mem_size)
 {
     int ret;
@@ -74,10 +208,7 @@ struct ukvm_hv *ukvm_hv_init(size_t mem_size)
     if (hvb->vcpurun == MAP_FAILED)
         err(1, "KVM: VCPU mmap failed");
 
-    hv->mem = mmap(NULL, mem_size, PROT_READ | PROT_WRITE,
-               MAP_SHARED | MAP_ANONYMOUS, -1, 0);
-    if (hv->mem == MAP_FAILED)
-        err(1, "Error allocating guest memory");
+    hv->mem = mem_alloc(mem_size);
     hv->mem_size = mem_size;
 
     struct kvm_userspace_memory_region region = {
@@ -89,7 +220,17 @@ struct ukvm_hv *ukvm_hv_init(size_t mem_size)
     ret = ioctl(hvb->vmfd, KVM_SET_USER_MEMORY_REGION, &region);
     if (ret == -1)
         err(1, "KVM: ioctl (SET_USER_MEMORY_REGION) failed");
+    hvb->nslots = 1;
 
     hv->b = hvb;
     return hv;
 }
+
+void ukvm_hv_vcpu_kick(struct ukvm_hv *hv)
+{
+    /*
+     * A signal interrupts KVM_RUN if the VCPU is in the guest; if it is not,
+     * (immediate_exit) makes the next KVM_RUN return EINTR immediately.
+     */
+    hv->b->vcpurun->immediate_exit = 1;
+}
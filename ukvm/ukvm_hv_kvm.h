@@ -30,6 +30,9 @@ struct ukvm_hvb {
     int vmfd;
     int vcpufd;
     struct kvm_run *vcpurun;
+    uint32_t nslots;            /* Memory slots in use */
+    uint64_t map_end;           /* End of ukvm_hv_map_readonly() mappings */
+    int sync_regs;              /* KVM_SYNC_X86_REGS is enabled (x86_64) */
 };
 
 #endif /* UKVM_HV_KVM_H */
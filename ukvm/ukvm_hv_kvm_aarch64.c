@@ -73,6 +73,9 @@
 /* Generic Purpose register x0 */
 #define REG_X0              ARM64_CORE_REG(regs.regs[0])
 
+/* Frame pointer (x29) */
+#define REG_X29             ARM64_CORE_REG(regs.regs[29])
+
 /* Architectural Feature Access Control Register EL1 */
 #define CPACR_EL1           ARM64_SYS_REG(3, 0, 1, 0, 2)
 #define _FPEN_NOTRAP        0x3
@@ -331,15 +334,65 @@ static inline uint32_t mmio_read32(void *data)
     return *(uint32_t *)data;
 }
 
+int ukvm_hv_map_readonly(struct ukvm_hv *hv __attribute__((unused)),
+        void *addr __attribute__((unused)), size_t len __attribute__((unused)),
+        ukvm_gpa_t *gpa __attribute__((unused)))
+{
+    /*
+     * Not implemented.
+     */
+    return -1;
+}
+
+int ukvm_hv_vcpu_save(struct ukvm_hv *hv __attribute__((unused)),
+        void **state __attribute__((unused)),
+        size_t *len __attribute__((unused)))
+{
+    /*
+     * Not implemented.
+     */
+    return -1;
+}
+
+int ukvm_hv_vcpu_restore(struct ukvm_hv *hv __attribute__((unused)),
+        const void *state __attribute__((unused)),
+        size_t len __attribute__((unused)),
+        uint64_t nsecs __attribute__((unused)))
+{
+    /*
+     * Not implemented.
+     */
+    return -1;
+}
+
+int ukvm_hv_vcpu_sample(struct ukvm_hv *hv, uint64_t *pc, uint64_t *fp)
+{
+    if (aarch64_get_one_register(hv->b->vcpufd, REG_PC, pc) == -1 ||
+            aarch64_get_one_register(hv->b->vcpufd, REG_X29, fp) == -1)
+        return -1;
+    return 0;
+}
+
 void ukvm_hv_vcpu_loop(struct ukvm_hv *hv)
 {
     struct ukvm_hvb *hvb = hv->b;
     int ret;
 
     while (1) {
-        ret = ioctl(hvb->vcpufd, KVM_RUN, NULL);
-        if (ret == -1 && errno == EINTR)
+        if (ukvm_stats_enabled) {
+            uint64_t ta = ukvm_stats_now();
+
+            ret = ioctl(hvb->vcpufd, KVM_RUN, NULL);
+            ukvm_stats->run_nsecs += ukvm_stats_now() - ta;
+        }
+        else
+            ret = ioctl(hvb->vcpufd, KVM_RUN, NULL);
+        if (ret == -1 && errno == EINTR) {
+            hvb->vcpurun->immediate_exit = 0;
+            if (ukvm_profile_pending)
+                ukvm_profile_sample(hv);
             continue;
+        }
         if (ret == -1) {
             if (errno == EFAULT) {
                 uint64_t pc;
@@ -360,6 +413,7 @@ void ukvm_hv_vcpu_loop(struct ukvm_hv *hv)
 
         struct kvm_run *run = hvb->vcpurun;
 
+        UKVM_STATS_EXIT(run->exit_reason);
         switch (run->exit_reason) {
         case KVM_EXIT_MMIO: {
             if (!run->mmio.is_write || run->mmio.len != 4)
@@ -375,12 +429,8 @@ void ukvm_hv_vcpu_loop(struct ukvm_hv *hv)
             if (nr == UKVM_HYPERCALL_HALT)
                 return;
 
-            ukvm_hypercall_fn_t fn = ukvm_core_hypercalls[nr];
-            if (fn == NULL)
-                errx(1, "Invalid guest hypercall: num=%d", nr);
-
             ukvm_gpa_t gpa = mmio_read32(run->mmio.data);
-            fn(hv, gpa);
+            ukvm_core_hypercall(hv, nr, gpa);
             break;
         }
 
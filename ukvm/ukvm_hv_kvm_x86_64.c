@@ -42,10 +42,14 @@ void ukvm_hv_mem_size(size_t *mem_size) {
     ukvm_x86_mem_size(mem_size);
 }
 
-static void setup_cpuid(struct ukvm_hvb *hvb)
+/*
+ * Returns 1 if the guest CPU supports 1GB pages.
+ */
+static int setup_cpuid(struct ukvm_hvb *hvb)
 {
     struct kvm_cpuid2 *kvm_cpuid;
     int max_entries = 100;
+    int gbpages = 0;
 
     kvm_cpuid = calloc(1, sizeof(*kvm_cpuid) +
                           max_entries * sizeof(*kvm_cpuid->entries));
@@ -57,6 +61,13 @@ static void setup_cpuid(struct ukvm_hvb *hvb)
 
     if (ioctl(hvb->vcpufd, KVM_SET_CPUID2, kvm_cpuid) < 0)
         err(1, "KVM: ioctl (SET_CPUID2) failed");
+
+    for (unsigned i = 0; i < kvm_cpuid->nent; i++) {
+        if (kvm_cpuid->entries[i].function == 0x80000001)
+            gbpages = (kvm_cpuid->entries[i].edx & (1U << 26)) != 0;
+    }
+    free(kvm_cpuid);
+    return gbpages;
 }
 
 static struct kvm_segment sreg_to_kvm(const struct x86_sreg *sreg)
@@ -83,9 +94,7 @@ void ukvm_hv_vcpu_init(struct ukvm_hv *hv, ukvm_gpa_t gpa_ep,
     int ret;
 
     ukvm_x86_setup_gdt(hv->mem);
-    ukvm_x86_setup_pagetables(hv->mem, hv->mem_size);
-
-    setup_cpuid(hvb);
+    ukvm_x86_setup_pagetables(hv->mem, hv->mem_size, setup_cpuid(hvb));
 
     struct kvm_sregs sregs = {
         .cr0 = X86_CR0_INIT,
@@ -147,18 +156,203 @@ void ukvm_hv_vcpu_init(struct ukvm_hv *hv, ukvm_gpa_t gpa_ep,
     if (ret == -1)
         err(1, "KVM: ioctl (SET_REGS) failed");
 
+    /*
+     * Guests with more than 4GB of memory pass hypercall arguments in RAX
+     * (see hypercall_gpa()); have KVM return it with every exit if it can.
+     */
+    if (hv->mem_size > (1ULL << 32)) {
+        ret = ioctl(hvb->kvmfd, KVM_CHECK_EXTENSION, KVM_CAP_SYNC_REGS);
+        if (ret > 0 && (ret & KVM_SYNC_X86_REGS)) {
+            hvb->vcpurun->kvm_valid_regs = KVM_SYNC_X86_REGS;
+            hvb->sync_regs = 1;
+        }
+    }
+
     *cmdline = (char *)(hv->mem + X86_CMDLINE_BASE);
 }
 
+int ukvm_hv_map_readonly(struct ukvm_hv *hv, void *addr, size_t len,
+        ukvm_gpa_t *gpa)
+{
+    struct ukvm_hvb *hvb = hv->b;
+    ukvm_gpa_t base;
+
+    if (ioctl(hvb->kvmfd, KVM_CHECK_EXTENSION, KVM_CAP_READONLY_MEM) <= 0)
+        return -1;
+
+    /*
+     * Mappings start at the first 1GB boundary after guest memory, so that
+     * they never share a PDE with it.
+     */
+    if (hvb->map_end == 0)
+        hvb->map_end = (hv->mem_size + (1ULL << 30) - 1) & ~((1ULL << 30) - 1);
+    base = hvb->map_end;
+    len = (len + 0xfff) & ~(size_t)0xfff;
+    if (ukvm_x86_map_readonly(hv->mem, base, len) == -1)
+        return -1;
+
+    struct kvm_userspace_memory_region region = {
+        .slot = hvb->nslots,
+        .flags = KVM_MEM_READONLY,
+        .guest_phys_addr = base,
+        .memory_size = len,
+        .userspace_addr = (uint64_t)addr,
+    };
+    if (ioctl(hvb->vmfd, KVM_SET_USER_MEMORY_REGION, &region) == -1)
+        return -1;
+
+    hvb->nslots++;
+    hvb->map_end = (base + len + X86_GUEST_PAGE_SIZE - 1) &
+        ~(uint64_t)(X86_GUEST_PAGE_SIZE - 1);
+    *gpa = base;
+    return 0;
+}
+
+#define MSR_IA32_TSC 0x10
+
+/*
+ * VCPU state saved by ukvm_hv_vcpu_save(). The guest does not enable XSAVE,
+ * so struct kvm_fpu covers all of its floating point state.
+ */
+struct vcpu_state {
+    uint32_t tsc_khz;
+    uint32_t reserved;
+    uint64_t tsc;
+    struct kvm_regs regs;
+    struct kvm_sregs sregs;
+    struct kvm_fpu fpu;
+};
+
+static int tsc_access(struct ukvm_hvb *hvb, int set, uint64_t *tsc)
+{
+    struct {
+        struct kvm_msrs hdr;
+        struct kvm_msr_entry entry;
+    } msrs;
+
+    memset(&msrs, 0, sizeof msrs);
+    msrs.hdr.nmsrs = 1;
+    msrs.entry.index = MSR_IA32_TSC;
+    msrs.entry.data = *tsc;
+    if (ioctl(hvb->vcpufd, set ? KVM_SET_MSRS : KVM_GET_MSRS, &msrs) != 1)
+        return -1;
+    *tsc = msrs.entry.data;
+    return 0;
+}
+
+int ukvm_hv_vcpu_save(struct ukvm_hv *hv, void **state, size_t *len)
+{
+    static struct vcpu_state vs;
+    struct ukvm_hvb *hvb = hv->b;
+    int ret;
+
+    /*
+     * KVM only completes the exit which stopped the VCPU, e.g. advancing RIP
+     * past the hypercall's OUT, when it is next run. Run it with
+     * (immediate_exit) set so that it returns straight away with its state
+     * consistent.
+     */
+    hvb->vcpurun->immediate_exit = 1;
+    ret = ioctl(hvb->vcpufd, KVM_RUN, NULL);
+    hvb->vcpurun->immediate_exit = 0;
+    if (ret != -1 || errno != EINTR)
+        return -1;
+
+    memset(&vs, 0, sizeof vs);
+    ret = ioctl(hvb->vcpufd, KVM_GET_TSC_KHZ);
+    if (ret == -1)
+        return -1;
+    vs.tsc_khz = ret;
+    if (ioctl(hvb->vcpufd, KVM_GET_REGS, &vs.regs) == -1 ||
+            ioctl(hvb->vcpufd, KVM_GET_SREGS, &vs.sregs) == -1 ||
+            ioctl(hvb->vcpufd, KVM_GET_FPU, &vs.fpu) == -1 ||
+            tsc_access(hvb, 0, &vs.tsc) == -1)
+        return -1;
+
+    *state = &vs;
+    *len = sizeof vs;
+    return 0;
+}
+
+int ukvm_hv_vcpu_restore(struct ukvm_hv *hv, const void *state, size_t len,
+        uint64_t nsecs)
+{
+    const struct vcpu_state *vs = state;
+    struct ukvm_hvb *hvb = hv->b;
+    uint64_t tsc;
+
+    if (len != sizeof (struct vcpu_state))
+        return -1;
+    /*
+     * The guest clock is calibrated for the TSC frequency it booted with.
+     */
+    if (ioctl(hvb->vcpufd, KVM_GET_TSC_KHZ) != (int)vs->tsc_khz)
+        return -1;
+
+    if (ioctl(hvb->vcpufd, KVM_SET_SREGS, &vs->sregs) == -1 ||
+            ioctl(hvb->vcpufd, KVM_SET_REGS, &vs->regs) == -1 ||
+            ioctl(hvb->vcpufd, KVM_SET_FPU, &vs->fpu) == -1)
+        return -1;
+
+    /*
+     * Advance the TSC by the time elapsed since the snapshot, so that the
+     * guest's monotonic and wall clocks carry on from where they were.
+     */
+    tsc = vs->tsc + (nsecs / 1000000) * vs->tsc_khz +
+        (nsecs % 1000000) * vs->tsc_khz / 1000000;
+    return tsc_access(hvb, 1, &tsc);
+}
+
+int ukvm_hv_vcpu_sample(struct ukvm_hv *hv, uint64_t *pc, uint64_t *fp)
+{
+    struct kvm_regs regs;
+
+    if (ioctl(hv->b->vcpufd, KVM_GET_REGS, &regs) == -1)
+        return -1;
+    *pc = regs.rip;
+    *fp = regs.rbp;
+    return 0;
+}
+
+/*
+ * Returns the address of the argument of the hypercall which caused the
+ * current exit, given (lo) from the PIO data. This is only the lower 32 bits,
+ * so for guests with more than 4GB of memory take the address from RAX.
+ */
+static ukvm_gpa_t hypercall_gpa(struct ukvm_hv *hv, uint32_t lo)
+{
+    struct ukvm_hvb *hvb = hv->b;
+    struct kvm_regs regs;
+
+    if (hv->mem_size <= (1ULL << 32))
+        return lo;
+    if (hvb->sync_regs)
+        return hvb->vcpurun->s.regs.regs.rax;
+    if (ioctl(hvb->vcpufd, KVM_GET_REGS, &regs) == -1)
+        err(1, "KVM: ioctl (GET_REGS) failed");
+    return regs.rax;
+}
+
 void ukvm_hv_vcpu_loop(struct ukvm_hv *hv)
 {
     struct ukvm_hvb *hvb = hv->b;
     int ret;
 
     while (1) {
-        ret = ioctl(hvb->vcpufd, KVM_RUN, NULL);
-        if (ret == -1 && errno == EINTR)
+        if (ukvm_stats_enabled) {
+            uint64_t ta = ukvm_stats_now();
+
+            ret = ioctl(hvb->vcpufd, KVM_RUN, NULL);
+            ukvm_stats->run_nsecs += ukvm_stats_now() - ta;
+        }
+        else
+            ret = ioctl(hvb->vcpufd, KVM_RUN, NULL);
+        if (ret == -1 && errno == EINTR) {
+            hvb->vcpurun->immediate_exit = 0;
+            if (ukvm_profile_pending)
+                ukvm_profile_sample(hv);
             continue;
+        }
         if (ret == -1) {
             if (errno == EFAULT) {
                 struct kvm_regs regs;
@@ -180,6 +374,7 @@ void ukvm_hv_vcpu_loop(struct ukvm_hv *hv)
 
         struct kvm_run *run = hvb->vcpurun;
 
+        UKVM_STATS_EXIT(run->exit_reason);
         switch (run->exit_reason) {
         case KVM_EXIT_HLT:
             /* Guest has halted the CPU, this is considered as a normal exit. */
@@ -194,13 +389,9 @@ void ukvm_hv_vcpu_loop(struct ukvm_hv *hv)
                 errx(1, "Invalid guest port access: port=0x%x", run->io.port);
 
             int nr = run->io.port - UKVM_HYPERCALL_PIO_BASE;
-            ukvm_hypercall_fn_t fn = ukvm_core_hypercalls[nr];
-            if (fn == NULL)
-                errx(1, "Invalid guest hypercall: num=%d", nr);
-
-            ukvm_gpa_t gpa =
-                *(uint32_t *)((uint8_t *)run + run->io.data_offset);
-            fn(hv, gpa);
+            ukvm_gpa_t gpa = hypercall_gpa(hv,
+                *(uint32_t *)((uint8_t *)run + run->io.data_offset));
+            ukvm_core_hypercall(hv, nr, gpa);
             break;
         }
 
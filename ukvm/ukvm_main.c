@@ -97,14 +97,72 @@ static void handle_mem(char *cmdarg, size_t *mem_size)
     *mem_size = mem;
 }
 
+enum ukvm_hugepages ukvm_hugepages;
+const char *ukvm_hugetlbfs_path;
+
+static void handle_mem_hugepages(char *cmdarg)
+{
+    const char *arg = cmdarg + 16;
+
+    if (strcmp(arg, "auto") == 0)
+        ukvm_hugepages = UKVM_HUGEPAGES_AUTO;
+    else if (strcmp(arg, "thp") == 0)
+        ukvm_hugepages = UKVM_HUGEPAGES_THP;
+    else if (strcmp(arg, "hugetlbfs") == 0)
+        ukvm_hugepages = UKVM_HUGEPAGES_HUGETLBFS;
+    else if (strncmp(arg, "hugetlbfs:", 10) == 0 && arg[10]) {
+        ukvm_hugepages = UKVM_HUGEPAGES_HUGETLBFS;
+        ukvm_hugetlbfs_path = arg + 10;
+    }
+    else
+        errx(1, "Malformed argument to --mem-hugepages");
+}
+
+/*
+ * Returns 1 if read-only segments of the guest binary can be mapped from the
+ * file into guest memory rather than copied. This needs the hypervisor to
+ * follow the monitor's mappings of guest memory, which KVM does. Huge pages
+ * cannot be partially replaced by file pages, so they are not combined with
+ * mapping.
+ */
+static int elf_map_ok(void)
+{
+#if defined(__linux__)
+    return ukvm_hugepages == UKVM_HUGEPAGES_NONE;
+#else
+    return 0;
+#endif
+}
+
 static void usage(const char *prog)
 {
     fprintf(stderr, "usage: %s [ CORE OPTIONS ] [ MODULE OPTIONS ] [ -- ] "
             "KERNEL [ ARGS ]\n", prog);
+    fprintf(stderr, "       %s --restore=FILE [ CORE OPTIONS ] "
+            "[ MODULE OPTIONS ]\n", prog);
+    fprintf(stderr, "       %s --zygote=SOCKET [ CORE OPTIONS ] "
+            "[ MODULE OPTIONS ] [ -- ] KERNEL\n", prog);
+    fprintf(stderr, "       %s --zygote=SOCKET --restore=FILE "
+            "[ CORE OPTIONS ] [ MODULE OPTIONS ]\n", prog);
     fprintf(stderr, "KERNEL is the filename of the unikernel to run.\n");
     fprintf(stderr, "ARGS are optional arguments passed to the unikernel.\n");
     fprintf(stderr, "Core options:\n");
     fprintf(stderr, "  [ --mem=512 ] (guest memory in MB)\n");
+    fprintf(stderr, "  [ --mem-hugepages=auto|thp|hugetlbfs[:PATH] ] "
+            "(back guest memory\n    with huge pages)\n");
+    fprintf(stderr, "  [ --stats=PATH ] (export statistics to PATH, "
+            "e.g. /dev/shm/ukvm.NAME)\n");
+    fprintf(stderr, "  [ --trace=FILE ] (trace hypercalls to FILE, "
+            "see ukvm-trace)\n");
+    fprintf(stderr, "  [ --profile=FILE[,HZ] ] (sample guest stacks at HZ, "
+            "default 99, to FILE)\n");
+    fprintf(stderr, "  [ --snapshot=FILE ] (save a snapshot of the guest to "
+            "FILE before\n    solo5_app_main() and exit)\n");
+    fprintf(stderr, "  [ --restore=FILE ] (run the guest from the snapshot in "
+            "FILE, instead of\n    KERNEL and ARGS)\n");
+    fprintf(stderr, "  [ --zygote=SOCKET ] (load KERNEL or FILE once and "
+            "start instances of it\n    on requests to SOCKET, see "
+            "ukvm-launch)\n");
     fprintf(stderr, "    --help (display this help)\n");
     fprintf(stderr, "Compiled-in modules: ");
     for (struct ukvm_module **m = ukvm_core_modules; *m; m++) {
@@ -131,6 +189,8 @@ int main(int argc, char **argv)
     ukvm_gpa_t gpa_ep, gpa_kend;
     const char *prog;
     const char *elffile;
+    const char *restore = NULL;
+    const char *zygote = NULL;
     int matched;
 
     prog = basename(*argv);
@@ -155,7 +215,25 @@ int main(int argc, char **argv)
             argc--;
             argv++;
         }
-        if (handle_cmdarg(*argv) == 0) {
+        else if (strncmp("--mem-hugepages=", *argv, 16) == 0) {
+            handle_mem_hugepages(*argv);
+            matched = 1;
+            argc--;
+            argv++;
+        }
+        else if (strncmp("--restore=", *argv, 10) == 0) {
+            restore = *argv + 10;
+            matched = 1;
+            argc--;
+            argv++;
+        }
+        else if (strncmp("--zygote=", *argv, 9) == 0) {
+            zygote = *argv + 9;
+            matched = 1;
+            argc--;
+            argv++;
+        }
+        else if (handle_cmdarg(*argv) == 0) {
             /* Handled by module, consume and go on to next arg */
             matched = 1;
             argc--;
@@ -167,14 +245,28 @@ int main(int argc, char **argv)
         }
     }
 
-    /* At least one non-option argument required */
-    if (*argv == NULL) {
-        warnx("Missing KERNEL operand");
-        usage(prog);
+    if (restore) {
+        /*
+         * The snapshot contains the guest and its command line, and
+         * determines the size of guest memory.
+         */
+        if (*argv != NULL) {
+            warnx("KERNEL and ARGS cannot be used with --restore");
+            usage(prog);
+        }
+        mem_size = ukvm_snapshot_open(restore);
+        elffile = NULL;
+    }
+    else {
+        /* At least one non-option argument required */
+        if (*argv == NULL) {
+            warnx("Missing KERNEL operand");
+            usage(prog);
+        }
+        elffile = *argv;
+        argc--;
+        argv++;
     }
-    elffile = *argv;
-    argc--;
-    argv++;
 
     struct sigaction sa;
     memset (&sa, 0, sizeof (struct sigaction));
@@ -186,13 +278,53 @@ int main(int argc, char **argv)
         err(1, "Could not install signal handler");
 
     ukvm_hv_mem_size(&mem_size);
-    struct ukvm_hv *hv = ukvm_hv_init(mem_size);
 
-    ukvm_elf_load(elffile, hv->mem, hv->mem_size, &gpa_ep, &gpa_kend);
+    if (zygote) {
+        if (argc > 0) {
+            warnx("ARGS cannot be used with --zygote");
+            usage(prog);
+        }
+        /*
+         * With --restore, instances are restored from the snapshot instead of
+         * being started from a loaded image.
+         */
+        ukvm_zygote_serve(zygote, elffile, mem_size, &argc, &argv, &gpa_ep,
+                &gpa_kend);
+
+        /*
+         * In a new instance; handle its own module options.
+         */
+        while (*argv && *argv[0] == '-') {
+            if (strcmp("--", *argv) == 0) {
+                argc--;
+                argv++;
+                break;
+            }
+            if (handle_cmdarg(*argv) != 0)
+                errx(1, "Invalid option: `%s'", *argv);
+            argc--;
+            argv++;
+        }
+        if (restore && *argv != NULL)
+            errx(1, "ARGS cannot be used with --restore");
+    }
+
+    struct ukvm_hv *hv = ukvm_hv_init(mem_size);
 
     char *cmdline;
-    ukvm_hv_vcpu_init(hv, gpa_ep, gpa_kend, &cmdline);
-    setup_cmdline(cmdline, argc, argv);
+    if (restore) {
+        ukvm_hv_vcpu_init(hv, 0, 0, &cmdline);
+        ukvm_snapshot_restore(hv);
+    }
+    else {
+        if (zygote)
+            ukvm_zygote_map(hv);
+        else
+            ukvm_elf_load(elffile, hv->mem, hv->mem_size, elf_map_ok(),
+                    &gpa_ep, &gpa_kend);
+        ukvm_hv_vcpu_init(hv, gpa_ep, gpa_kend, &cmdline);
+        setup_cmdline(cmdline, argc, argv);
+    }
 
     setup_modules(hv);
 
@@ -25,50 +25,432 @@
 #define _GNU_SOURCE
 #include <assert.h>
 #include <err.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
 #include <unistd.h>
+#if defined(__linux__)
+#include <linux/fs.h>
+#elif defined(__FreeBSD__)
+#include <sys/disk.h>
+#endif
 
 #include "ukvm.h"
 
-static struct ukvm_blkinfo blkinfo;
-static char *diskfile;
-static int diskfd;
+struct overlay;
+
+/*
+ * A block device (--disk=[NAME:]IMAGE). The handle of a device is its index
+ * in (disks), so the first one given is the default device.
+ *
+ * A ram disk (--disk=[NAME:]ram:SIZE) is kept in anonymous memory at (ram)
+ * and has no (fd). Its contents are lost when ukvm exits.
+ */
+struct blk_disk {
+    char name[UKVM_BLK_NAME_MAX];       /* Empty if unnamed */
+    const char *path;
+    const char *base;                   /* --disk-base, or NULL */
+    int fd;
+    struct ukvm_blkinfo info;
+    size_t direct_align;                /* 0 if not using O_DIRECT */
+    struct overlay *ov;                 /* NULL if not an overlay */
+    size_t ram_size;                    /* 0 if not a ram disk */
+    uint8_t *ram;
+};
+
+static struct blk_disk disks[UKVM_BLK_MAX];
+static int ndisks;
+
+/*
+ * Statistics for disk (d).
+ */
+#define BLK_STATS(d) blk[(d) - disks]
+
+static int cmdline_direct;
+static int cmdline_map;
+static size_t cmdline_sector_size;      /* 0 to detect */
+
+/*
+ * Host write cache mode (--disk-cache). With writeback, guest flushes are
+ * passed on to the host with fdatasync(). With writethrough the disk is opened
+ * with O_DSYNC so there is nothing left to flush, and with unsafe flushes are
+ * ignored.
+ */
+enum {
+    CACHE_WRITEBACK,
+    CACHE_WRITETHROUGH,
+    CACHE_UNSAFE
+};
+static int cache_mode = CACHE_WRITEBACK;
+
+/*
+ * With --disk-direct disks are opened with O_DIRECT, and I/O whose buffer,
+ * length or offset is not a multiple of the disk's (direct_align) is copied
+ * through a bounce buffer instead. Bouncing is only ever done on the VCPU
+ * thread, so a single buffer is enough.
+ */
+#define BOUNCE_SIZE (1024 * 1024)
+static uint8_t *bounce;
+
+/*
+ * Asynchronous I/O (UKVM_HYPERCALL_BLKRING). Requests taken from the guest's
+ * submission queue are started by an I/O engine, which calls blk_complete()
+ * from its own thread(s) as each one finishes.
+ */
+struct blk_req {
+    uint64_t id;
+    uint32_t op;                /* UKVM_BLK_OP_* */
+    struct blk_disk *disk;
+    struct iovec iov;
+    off_t pos;
+    struct blk_req *next;       /* Free list or engine queue */
+};
+
+struct blk_engine {
+    const char *name;
+    int (*init)(void);
+    void (*submit)(struct blk_req *req);
+    void (*start)(void);        /* Start all requests submitted so far */
+};
+
+static void blk_complete(struct blk_req *req, ssize_t ret);
+
+#include "ukvm_blk_uring.c"
+#include "ukvm_blk_threads.c"
+
+#include "ukvm_blk_overlay.c"
+
+static struct blk_engine *engines[] = {
+#ifdef UKVM_BLK_URING
+    &uring_engine,
+#endif
+    &threads_engine
+};
+
+static struct {
+    struct ukvm_blkring *ring;
+    struct blk_engine *engine;
+    struct blk_req reqs[UKVM_BLKRING_ENTRIES];
+    struct blk_req *free;
+    uint32_t accepted;          /* VCPU thread only */
+    pthread_mutex_t lock;       /* Protects (free) and CQ production */
+    int notifyfd[2];
+} aio = {
+    .lock = PTHREAD_MUTEX_INITIALIZER
+};
+
+/*
+ * Returns the disk for (handle), or NULL if it is not valid.
+ */
+static struct blk_disk *blk_disk(int handle)
+{
+    return (handle >= 0 && handle < ndisks) ? &disks[handle] : NULL;
+}
+
+static int blk_aligned(struct blk_disk *d, const void *buf, size_t len,
+        off_t pos)
+{
+    return (((uintptr_t)buf | (uintptr_t)len | (uintptr_t)pos) &
+            (d->direct_align - 1)) == 0;
+}
+
+/*
+ * Transfer (len) bytes between (buf) and the disk at (pos) through the bounce
+ * buffer, widening each chunk to whole aligned blocks. When writing, partial
+ * blocks are read first so that their other contents are preserved.
+ */
+static ssize_t blk_bounce(struct blk_disk *d, int write, uint8_t *buf,
+        size_t len, off_t pos)
+{
+    size_t align = d->direct_align, done = 0;
+
+    while (done < len) {
+        off_t start = (pos + done) & ~(off_t)(align - 1);
+        size_t skip = pos + done - start;
+        size_t n = len - done, span;
+
+        if (n > BOUNCE_SIZE - skip)
+            n = BOUNCE_SIZE - skip;
+        span = (skip + n + align - 1) & ~(align - 1);
+        if (!write || skip != 0 || span != skip + n) {
+            if (pread(d->fd, bounce, span, start) != (ssize_t)span)
+                return -1;
+        }
+        if (write) {
+            memcpy(bounce + skip, buf + done, n);
+            if (pwrite(d->fd, bounce, span, start) != (ssize_t)span)
+                return -1;
+        }
+        else
+            memcpy(buf + done, bounce + skip, n);
+        done += n;
+    }
+    return len;
+}
+
+/*
+ * pread()/pwrite() on the disk, going through the overlay if there is one,
+ * and bouncing if required by --disk-direct. Ram disks are copied directly.
+ */
+static ssize_t blk_pread(struct blk_disk *d, void *buf, size_t len, off_t pos)
+{
+    if (d->ram) {
+        memcpy(buf, d->ram + pos, len);
+        return len;
+    }
+    if (d->ov)
+        return overlay_pread(d->ov, buf, len, pos);
+    if (d->direct_align && !blk_aligned(d, buf, len, pos)) {
+        UKVM_STATS_ADD(BLK_STATS(d).bounced, 1);
+        return blk_bounce(d, 0, buf, len, pos);
+    }
+    if (d->direct_align)
+        UKVM_STATS_ADD(BLK_STATS(d).direct, 1);
+    return pread(d->fd, buf, len, pos);
+}
+
+static ssize_t blk_pwrite(struct blk_disk *d, const void *buf, size_t len,
+        off_t pos)
+{
+    if (d->ram) {
+        memcpy(d->ram + pos, buf, len);
+        return len;
+    }
+    if (d->ov)
+        return overlay_pwrite(d->ov, buf, len, pos);
+    if (d->direct_align && !blk_aligned(d, buf, len, pos)) {
+        UKVM_STATS_ADD(BLK_STATS(d).bounced, 1);
+        return blk_bounce(d, 1, (uint8_t *)buf, len, pos);
+    }
+    if (d->direct_align)
+        UKVM_STATS_ADD(BLK_STATS(d).direct, 1);
+    return pwrite(d->fd, buf, len, pos);
+}
+
+/*
+ * preadv()/pwritev() on the disk. With an overlay or a ram disk, or with
+ * --disk-direct if any segment is not aligned, each segment is transferred
+ * separately.
+ */
+static ssize_t blk_prwv(struct blk_disk *d, int write, const struct iovec *iov,
+        int cnt, off_t pos)
+{
+    ssize_t ret, total = 0;
+    int i, whole = (d->ov == NULL && d->ram == NULL);
+
+    for (i = 0; whole && d->direct_align && i < cnt; i++) {
+        if (!blk_aligned(d, iov[i].iov_base, iov[i].iov_len, pos))
+            whole = 0;
+    }
+    if (whole) {
+        if (d->direct_align)
+            UKVM_STATS_ADD(BLK_STATS(d).direct, cnt);
+        return write ? pwritev(d->fd, iov, cnt, pos) :
+            preadv(d->fd, iov, cnt, pos);
+    }
+
+    for (i = 0; i < cnt; i++) {
+        ret = write ? blk_pwrite(d, iov[i].iov_base, iov[i].iov_len, pos) :
+            blk_pread(d, iov[i].iov_base, iov[i].iov_len, pos);
+        if (ret != (ssize_t)iov[i].iov_len)
+            return -1;
+        pos += ret;
+        total += ret;
+    }
+    return total;
+}
+
+static void hypercall_blkopen(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    struct ukvm_blkopen *o =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_blkopen));
+    int i;
+
+    o->ret = -1;
+    for (i = 0; i < ndisks; i++) {
+        if (!strncmp(disks[i].name, o->name, sizeof o->name)) {
+            o->handle = i;
+            o->ret = 0;
+            break;
+        }
+    }
+}
 
 static void hypercall_blkinfo(struct ukvm_hv *hv, ukvm_gpa_t gpa)
 {
     struct ukvm_blkinfo *info =
         UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_blkinfo));
+    struct blk_disk *d = blk_disk(info->handle);
+
+    info->sector_size = d ? d->info.sector_size : 0;
+    info->num_sectors = d ? d->info.num_sectors : 0;
+    info->rw = d ? d->info.rw : 0;
+    info->map = d ? d->info.map : 0;
+}
+
+static void hypercall_blkflush(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    struct ukvm_blkflush *fl =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_blkflush));
+    struct blk_disk *d = blk_disk(fl->handle);
+
+    if (d == NULL) {
+        fl->ret = -1;
+        return;
+    }
+    UKVM_STATS_ADD(BLK_STATS(d).flushes, 1);
+    if (cache_mode == CACHE_WRITEBACK && d->ram == NULL &&
+            fdatasync(d->fd) == -1)
+        fl->ret = -1;
+    else
+        fl->ret = 0;
+}
+
+/*
+ * Validate the range of (nsectors) sectors starting at (sector) on (d), and
+ * return its byte offset and length in (*pos) and (*len).
+ */
+static int blk_range(struct blk_disk *d, size_t sector, size_t nsectors,
+        off_t *pos, off_t *len)
+{
+    if (d == NULL || sector > d->info.num_sectors ||
+            nsectors > d->info.num_sectors - sector)
+        return -1;
+    *pos = (off_t)d->info.sector_size * (off_t)sector;
+    *len = (off_t)d->info.sector_size * (off_t)nsectors;
+    return 0;
+}
 
-    info->sector_size = blkinfo.sector_size;
-    info->num_sectors = blkinfo.num_sectors;
-    info->rw = blkinfo.rw;
+/*
+ * Validate a transfer of (len) bytes starting at (sector) on (d), and return
+ * its byte offset in (*pos).
+ */
+static int blk_check(struct blk_disk *d, size_t sector, size_t len,
+        off_t *pos)
+{
+    off_t end;
+
+    if (d == NULL || sector >= d->info.num_sectors || len > SSIZE_MAX)
+        return -1;
+    *pos = (off_t)d->info.sector_size * (off_t)sector;
+    if (add_overflow(*pos, len, end)
+            || (end > d->info.num_sectors * d->info.sector_size))
+        return -1;
+    return 0;
+}
+
+static void hypercall_blkdiscard(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    struct ukvm_blkdiscard *dc =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_blkdiscard));
+    struct blk_disk *d = blk_disk(dc->handle);
+    off_t pos, len;
+
+    if (blk_range(d, dc->sector, dc->nsectors, &pos, &len) == -1) {
+        dc->ret = -1;
+        return;
+    }
+    /*
+     * Discard is only a hint, so failure to punch a hole (e.g. because the
+     * host file system does not support it) is not an error. Whole pages of
+     * a ram disk are released, and read back as zeroes.
+     */
+    if (d->ram) {
+        uintptr_t start = ((uintptr_t)d->ram + pos + 4095) & ~(uintptr_t)4095;
+        uintptr_t end = ((uintptr_t)d->ram + pos + len) & ~(uintptr_t)4095;
+
+        if (end > start)
+            (void)madvise((void *)start, end - start, MADV_DONTNEED);
+        dc->ret = 0;
+        return;
+    }
+#ifdef FALLOC_FL_PUNCH_HOLE
+    if (len > 0 && d->ov == NULL)
+        (void)fallocate(d->fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                pos, len);
+#endif
+    dc->ret = 0;
+}
+
+static void hypercall_blkwritezeroes(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    static uint8_t zeroes[64 * 1024] __attribute__((aligned(4096)));
+    struct ukvm_blkwritezeroes *wz =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_blkwritezeroes));
+    struct blk_disk *d = blk_disk(wz->handle);
+    off_t pos, len;
+    size_t n;
+
+    if (blk_range(d, wz->sector, wz->nsectors, &pos, &len) == -1) {
+        wz->ret = -1;
+        return;
+    }
+    wz->ret = 0;
+    if (len == 0)
+        return;
+    if (d->ram) {
+        memset(d->ram + pos, 0, len);
+        return;
+    }
+    if (d->ov)
+        goto write;
+
+#ifdef FALLOC_FL_ZERO_RANGE
+    if (fallocate(d->fd, FALLOC_FL_ZERO_RANGE | FALLOC_FL_KEEP_SIZE,
+                pos, len) == 0)
+        return;
+#endif
+#ifdef FALLOC_FL_PUNCH_HOLE
+    if (fallocate(d->fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                pos, len) == 0)
+        return;
+#endif
+    /*
+     * Neither is supported by the host file system, or the disk is an
+     * overlay; write the zeroes out.
+     */
+write:
+    while (len > 0) {
+        n = len < (off_t)sizeof zeroes ? (size_t)len : sizeof zeroes;
+        if (blk_pwrite(d, zeroes, n, pos) != (ssize_t)n) {
+            wz->ret = -1;
+            return;
+        }
+        pos += n;
+        len -= n;
+    }
 }
 
 static void hypercall_blkwrite(struct ukvm_hv *hv, ukvm_gpa_t gpa)
 {
     struct ukvm_blkwrite *wr =
         UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_blkwrite));
+    struct blk_disk *d = blk_disk(wr->handle);
     ssize_t ret;
-    off_t pos, end;
+    off_t pos;
 
     assert(wr->len <= SSIZE_MAX);
-    if (wr->sector >= blkinfo.num_sectors) {
-        wr->ret = -1;
-        return;
-    }
-    pos = (off_t)blkinfo.sector_size * (off_t)wr->sector;
-    if (add_overflow(pos, wr->len, end)
-            || (end > blkinfo.num_sectors * blkinfo.sector_size)) {
+    if (blk_check(d, wr->sector, wr->len, &pos) == -1) {
         wr->ret = -1;
         return;
     }
 
-    ret = pwrite(diskfd, UKVM_CHECKED_GPA_P(hv, wr->data, wr->len), wr->len,
+    ret = blk_pwrite(d, UKVM_CHECKED_GPA_P(hv, wr->data, wr->len), wr->len,
             pos);
     assert(ret == wr->len);
+    UKVM_STATS_ADD(BLK_STATS(d).writes, 1);
+    UKVM_STATS_ADD(BLK_STATS(d).write_bytes, ret);
     wr->ret = 0;
 }
 
@@ -76,49 +458,496 @@ static void hypercall_blkread(struct ukvm_hv *hv, ukvm_gpa_t gpa)
 {
     struct ukvm_blkread *rd =
         UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_blkread));
+    struct blk_disk *d = blk_disk(rd->handle);
     ssize_t ret;
-    off_t pos, end;
+    off_t pos;
 
     assert(rd->len <= SSIZE_MAX);
-    if (rd->sector >= blkinfo.num_sectors) {
-        rd->ret = -1;
-        return;
-    }
-    pos = (off_t)blkinfo.sector_size * (off_t)rd->sector;
-    if (add_overflow(pos, rd->len, end)
-            || (end > blkinfo.num_sectors * blkinfo.sector_size)) {
+    if (blk_check(d, rd->sector, rd->len, &pos) == -1) {
         rd->ret = -1;
         return;
     }
 
-    ret = pread(diskfd, UKVM_CHECKED_GPA_P(hv, rd->data, rd->len), rd->len,
+    ret = blk_pread(d, UKVM_CHECKED_GPA_P(hv, rd->data, rd->len), rd->len,
             pos);
     assert(ret == rd->len);
+    UKVM_STATS_ADD(BLK_STATS(d).reads, 1);
+    UKVM_STATS_ADD(BLK_STATS(d).read_bytes, ret);
     rd->ret = 0;
 }
 
+/*
+ * Transfers the (nsegs) segments described at (gpa). Segments which are
+ * adjacent on disk are coalesced into a single preadv() or pwritev(). Returns
+ * -1 without doing any I/O if any segment is invalid.
+ */
+static int blk_transfer_segs(struct ukvm_hv *hv, int handle, ukvm_gpa_t gpa,
+        size_t nsegs, int write)
+{
+    struct blk_disk *d = blk_disk(handle);
+    struct ukvm_blkseg *segs;
+    struct iovec iov[UKVM_BLKSEG_MAX];
+    off_t pos[UKVM_BLKSEG_MAX];
+    size_t i, start, total;
+    ssize_t ret;
+
+    if (d == NULL || nsegs > UKVM_BLKSEG_MAX)
+        return -1;
+    if (nsegs == 0)
+        return 0;
+    segs = UKVM_CHECKED_GPA_P(hv, gpa, nsegs * sizeof (struct ukvm_blkseg));
+
+    for (i = 0; i < nsegs; i++) {
+        if (blk_check(d, segs[i].sector, segs[i].len, &pos[i]) == -1)
+            return -1;
+        iov[i].iov_base = UKVM_CHECKED_GPA_P(hv, segs[i].data, segs[i].len);
+        iov[i].iov_len = segs[i].len;
+    }
+
+    for (start = 0; start < nsegs; start = i) {
+        total = iov[start].iov_len;
+        for (i = start + 1; i < nsegs
+                && pos[i] == pos[i - 1] + (off_t)iov[i - 1].iov_len; i++)
+            total += iov[i].iov_len;
+
+        ret = blk_prwv(d, write, &iov[start], i - start, pos[start]);
+        assert(ret == total);
+        if (write) {
+            UKVM_STATS_ADD(BLK_STATS(d).writes, i - start);
+            UKVM_STATS_ADD(BLK_STATS(d).write_bytes, ret);
+        }
+        else {
+            UKVM_STATS_ADD(BLK_STATS(d).reads, i - start);
+            UKVM_STATS_ADD(BLK_STATS(d).read_bytes, ret);
+        }
+    }
+    return 0;
+}
+
+static void hypercall_blkwritev(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    struct ukvm_blkwritev *wr =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_blkwritev));
+
+    wr->ret = blk_transfer_segs(hv, wr->handle, wr->segs, wr->nsegs, 1);
+}
+
+static void hypercall_blkreadv(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    struct ukvm_blkreadv *rd =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_blkreadv));
+
+    rd->ret = blk_transfer_segs(hv, rd->handle, rd->segs, rd->nsegs, 0);
+}
+
+/*
+ * Post the completion for (req), which transferred (ret) bytes or failed
+ * with ret == -1, and wake the guest if the completion queue was empty.
+ */
+static void blk_complete(struct blk_req *req, ssize_t ret)
+{
+    struct ukvm_blkring *ring = aio.ring;
+    struct ukvm_blkcqe *cqe;
+    uint32_t prod;
+
+    if (ret > 0 && req->op == UKVM_BLK_OP_WRITE) {
+        UKVM_STATS_ADD(BLK_STATS(req->disk).writes, 1);
+        UKVM_STATS_ADD(BLK_STATS(req->disk).write_bytes, ret);
+    }
+    else if (ret > 0 && req->op == UKVM_BLK_OP_READ) {
+        UKVM_STATS_ADD(BLK_STATS(req->disk).reads, 1);
+        UKVM_STATS_ADD(BLK_STATS(req->disk).read_bytes, ret);
+    }
+
+    pthread_mutex_lock(&aio.lock);
+    prod = ring->cq_prod;
+    cqe = &ring->cq[prod % UKVM_BLKRING_ENTRIES];
+    cqe->id = req->id;
+    cqe->ret = (ret == (ssize_t)req->iov.iov_len) ? 0 : -1;
+    __atomic_store_n(&ring->cq_prod, prod + 1, __ATOMIC_RELEASE);
+    req->next = aio.free;
+    aio.free = req;
+    pthread_mutex_unlock(&aio.lock);
+
+    /*
+     * Pairs with the barrier in the guest before it checks for completions
+     * and decides to block in UKVM_HYPERCALL_POLL.
+     */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&ring->cq_cons, __ATOMIC_ACQUIRE) == prod) {
+        char c = 0;
+        int rc = write(aio.notifyfd[1], &c, 1);
+        assert(rc == 1 || (rc == -1 && errno == EAGAIN));
+    }
+}
+
+static void blk_drain(int fd)
+{
+    char buf[64];
+
+    while (read(fd, buf, sizeof buf) > 0)
+        ;
+}
+
+static void hypercall_blkring(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    struct ukvm_blkring_setup *r =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_blkring_setup));
+    unsigned i;
+
+    if (aio.ring != NULL) {
+        r->ret = -1;
+        return;
+    }
+    aio.ring = UKVM_CHECKED_GPA_P(hv, r->ring, sizeof (struct ukvm_blkring));
+    for (i = 0; i < UKVM_BLKRING_ENTRIES; i++) {
+        aio.reqs[i].next = aio.free;
+        aio.free = &aio.reqs[i];
+    }
+
+    if (pipe(aio.notifyfd) == -1 ||
+            fcntl(aio.notifyfd[0], F_SETFL, O_NONBLOCK) == -1 ||
+            fcntl(aio.notifyfd[1], F_SETFL, O_NONBLOCK) == -1)
+        err(1, "Could not create block I/O notification pipe");
+    if (ukvm_core_register_pollfd(aio.notifyfd[0]) == -1 ||
+            ukvm_core_replace_pollfd(aio.notifyfd[0], aio.notifyfd[0],
+                blk_drain) == -1)
+        errx(1, "Could not register block I/O notification pipe");
+
+    /*
+     * Use the first engine which works on this host.
+     */
+    for (i = 0; i < sizeof engines / sizeof engines[0]; i++) {
+        if (engines[i]->init() == 0) {
+            aio.engine = engines[i];
+            break;
+        }
+    }
+    if (aio.engine == NULL)
+        errx(1, "Could not initialise asynchronous block I/O");
+
+    r->ret = 0;
+}
+
+static void hypercall_blksubmit(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    struct ukvm_blksubmit *s =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_blksubmit));
+    struct ukvm_blkring *ring = aio.ring;
+    uint32_t cons, prod;
+
+    if (ring == NULL) {
+        s->ret = -1;
+        return;
+    }
+
+    cons = ring->sq_cons;
+    prod = __atomic_load_n(&ring->sq_prod, __ATOMIC_ACQUIRE);
+    while (cons != prod) {
+        struct ukvm_blksqe sqe = ring->sq[cons % UKVM_BLKRING_ENTRIES];
+        struct blk_disk *d = blk_disk(sqe.handle);
+        struct blk_req *req;
+        int valid;
+
+        /*
+         * Every accepted request is eventually posted on the completion
+         * queue, so this also guarantees that it cannot overflow.
+         */
+        if (aio.accepted - __atomic_load_n(&ring->cq_cons, __ATOMIC_ACQUIRE)
+                == UKVM_BLKRING_ENTRIES)
+            break;
+        pthread_mutex_lock(&aio.lock);
+        req = aio.free;
+        assert(req != NULL);
+        aio.free = req->next;
+        pthread_mutex_unlock(&aio.lock);
+        aio.accepted++;
+        cons++;
+
+        req->id = sqe.id;
+        req->op = sqe.op;
+        req->disk = d;
+        if (sqe.op == UKVM_BLK_OP_FLUSH && d != NULL) {
+            UKVM_STATS_ADD(BLK_STATS(d).flushes, 1);
+            req->iov.iov_len = 0;
+            if (cache_mode == CACHE_WRITEBACK && d->ram == NULL)
+                aio.engine->submit(req);
+            else
+                blk_complete(req, 0);
+            continue;
+        }
+        req->iov.iov_len = sqe.len;
+        valid = (sqe.op == UKVM_BLK_OP_READ || sqe.op == UKVM_BLK_OP_WRITE)
+            && blk_check(d, sqe.sector, sqe.len, &req->pos) == 0;
+        if (!valid) {
+            req->iov.iov_len = 0;
+            blk_complete(req, -1);
+            continue;
+        }
+        req->iov.iov_base = UKVM_CHECKED_GPA_P(hv, sqe.data, sqe.len);
+        if (d->ov || d->ram || (d->direct_align &&
+                    !blk_aligned(d, req->iov.iov_base, sqe.len, req->pos))) {
+            /*
+             * Overlay and bounced requests are done synchronously, as the
+             * overlay metadata and the bounce buffer belong to the VCPU
+             * thread. Ram disk requests are only a memcpy().
+             */
+            blk_complete(req, req->op == UKVM_BLK_OP_WRITE ?
+                    blk_pwrite(d, req->iov.iov_base, sqe.len, req->pos) :
+                    blk_pread(d, req->iov.iov_base, sqe.len, req->pos));
+            continue;
+        }
+        if (d->direct_align)
+            UKVM_STATS_ADD(BLK_STATS(d).direct, 1);
+        aio.engine->submit(req);
+    }
+    __atomic_store_n(&ring->sq_cons, cons, __ATOMIC_RELEASE);
+    aio.engine->start();
+    s->ret = 0;
+}
+
+/*
+ * Add a disk for --disk=[NAME:]IMAGE or --disk=[NAME:]ram:SIZE. NAME is only
+ * recognised if it consists of letters, digits, '-' and '_', so that other
+ * images may contain a ':', and may not be "ram".
+ */
+static int disk_add(const char *arg)
+{
+    struct blk_disk *d;
+    size_t n = strspn(arg, "abcdefghijklmnopqrstuvwxyz"
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-_");
+
+    if (ndisks == UKVM_BLK_MAX)
+        return -1;
+    d = &disks[ndisks];
+    if (n > 0 && arg[n] == ':' && strncmp(arg, "ram:", 4)) {
+        if (n >= UKVM_BLK_NAME_MAX)
+            return -1;
+        memcpy(d->name, arg, n);
+        arg += n + 1;
+    }
+    if (*arg == '\0')
+        return -1;
+    d->path = arg;
+    if (!strncmp(arg, "ram:", 4)) {
+        char *end;
+        unsigned long long mb = strtoull(arg + 4, &end, 10);
+
+        if (end == arg + 4 || *end != '\0' || mb == 0 ||
+                mb > (SIZE_MAX >> 20))
+            return -1;
+        d->ram_size = (size_t)mb << 20;
+    }
+    ndisks++;
+    return 0;
+}
+
 static int handle_cmdarg(char *cmdarg)
 {
-    if (strncmp("--disk=", cmdarg, 7))
+    if (!strncmp("--disk=", cmdarg, 7)) {
+        return disk_add(cmdarg + 7);
+    }
+    else if (!strncmp("--disk-base=", cmdarg, 12)) {
+        /*
+         * Applies to the preceding --disk.
+         */
+        if (ndisks == 0 || disks[ndisks - 1].base != NULL)
+            return -1;
+        disks[ndisks - 1].base = cmdarg + 12;
+        return 0;
+    }
+    else if (!strcmp("--disk-direct", cmdarg)) {
+        cmdline_direct = 1;
+        return 0;
+    }
+    else if (!strcmp("--disk-map", cmdarg)) {
+        cmdline_map = 1;
+        return 0;
+    }
+    else if (!strcmp("--disk-sector-size=512", cmdarg)) {
+        cmdline_sector_size = 512;
+        return 0;
+    }
+    else if (!strcmp("--disk-sector-size=4096", cmdarg)) {
+        cmdline_sector_size = 4096;
+        return 0;
+    }
+    else if (!strcmp("--disk-cache=writeback", cmdarg)) {
+        cache_mode = CACHE_WRITEBACK;
+        return 0;
+    }
+    else if (!strcmp("--disk-cache=writethrough", cmdarg)) {
+        cache_mode = CACHE_WRITETHROUGH;
+        return 0;
+    }
+    else if (!strcmp("--disk-cache=unsafe", cmdarg)) {
+        cache_mode = CACHE_UNSAFE;
+        return 0;
+    }
+    else
         return -1;
-    diskfile = cmdarg + 7;
+}
+
+/*
+ * Find the smallest block size for which O_DIRECT reads of (d) succeed.
+ * Returns 0 if none does.
+ */
+static size_t direct_probe(struct blk_disk *d)
+{
+    size_t align;
 
+    for (align = 512; align <= 4096; align *= 2) {
+        if (pread(d->fd, bounce, align, 0) >= 0)
+            return align;
+        if (errno != EINVAL)
+            break;
+    }
     return 0;
 }
 
+/*
+ * Returns the logical sector size of (d): that given with
+ * --disk-sector-size, else that of the host device if (d) is a block device,
+ * else 512.
+ */
+static size_t sector_size(struct blk_disk *d)
+{
+    struct stat st;
+    unsigned ssz = 512;
+#if defined(BLKSSZGET)
+    int lssz;
+#elif defined(DIOCGSECTORSIZE)
+    u_int lssz;
+#endif
+
+    if (cmdline_sector_size)
+        return cmdline_sector_size;
+    if (d->ram)
+        return 512;
+    if (fstat(d->fd, &st) == -1)
+        err(1, "%s: fstat() failed", d->path);
+    if (!S_ISBLK(st.st_mode) && !S_ISCHR(st.st_mode))
+        return 512;
+#if defined(BLKSSZGET)
+    if (ioctl(d->fd, BLKSSZGET, &lssz) == 0)
+        ssz = lssz;
+#elif defined(DIOCGSECTORSIZE)
+    if (ioctl(d->fd, DIOCGSECTORSIZE, &lssz) == 0)
+        ssz = lssz;
+#endif
+    if (ssz != 512 && ssz != 4096)
+        errx(1, "%s: Unsupported sector size %u", d->path, ssz);
+    return ssz;
+}
+
+/*
+ * Allocate the memory for a ram disk. Transparent huge pages are requested
+ * where available, to reduce the host TLB cost of copying to and from it.
+ */
+static void disk_open_ram(struct blk_disk *d)
+{
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+    d->fd = -1;
+    d->ram = mmap(NULL, d->ram_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (d->ram == MAP_FAILED)
+        err(1, "%s: Could not allocate ram disk", d->path);
+#ifdef MADV_HUGEPAGE
+    (void)madvise(d->ram, d->ram_size, MADV_HUGEPAGE);
+#endif
+}
+
+static void disk_open(struct ukvm_hv *hv, struct blk_disk *d)
+{
+    if (d->ram_size)
+        disk_open_ram(d);
+    else {
+        d->fd = open(d->path, O_RDWR | (cmdline_direct ? O_DIRECT : 0) |
+                (cache_mode == CACHE_WRITETHROUGH ? O_DSYNC : 0) |
+                (d->base ? O_CREAT : 0), 0644);
+        if (d->fd == -1)
+            err(1, "Could not open disk: %s", d->path);
+    }
+
+    d->info.sector_size = sector_size(d);
+    if (d->ram)
+        d->info.num_sectors = d->ram_size / d->info.sector_size;
+    else if (d->base) {
+        d->ov = overlay_open(d->fd, d->path, d->base);
+        d->info.num_sectors = d->ov->hdr.size / d->info.sector_size;
+    }
+    else
+        d->info.num_sectors = lseek(d->fd, 0, SEEK_END) /
+            d->info.sector_size;
+    d->info.rw = 1;
+
+    if (cmdline_direct && d->ram == NULL) {
+        d->direct_align = direct_probe(d);
+        if (d->direct_align == 0)
+            errx(1, "%s: Direct I/O not supported", d->path);
+        /*
+         * Only expose whole aligned blocks, so that bounced I/O never needs
+         * to go past the end of the disk.
+         */
+        if (d->direct_align > d->info.sector_size)
+            d->info.num_sectors &=
+                ~(size_t)(d->direct_align / d->info.sector_size - 1);
+    }
+
+    /*
+     * With --disk-map the guest reads the disk directly from the host page
+     * cache, or from the memory of a ram disk. Writes still go through the
+     * monitor, and are visible in the mapping as soon as they complete.
+     */
+    if (cmdline_map && d->info.num_sectors > 0) {
+        size_t len = d->info.num_sectors * d->info.sector_size;
+        ukvm_gpa_t gpa;
+        void *p;
+
+        p = d->ram ? d->ram : mmap(NULL, len, PROT_READ, MAP_SHARED, d->fd, 0);
+        if (p == MAP_FAILED)
+            err(1, "%s: Could not map disk", d->path);
+        if (ukvm_hv_map_readonly(hv, p, len, &gpa) == -1)
+            errx(1, "%s: Could not map disk into guest", d->path);
+        d->info.map = gpa;
+    }
+}
+
 static int setup(struct ukvm_hv *hv)
 {
-    if (diskfile == NULL)
+    int i, j, overlay = 0;
+
+    if (ndisks == 0)
         return -1;
 
-    /* set up virtual disk */
-    diskfd = open(diskfile, O_RDWR);
-    if (diskfd == -1)
-        err(1, "Could not open disk: %s", diskfile);
+    for (i = 0; i < ndisks; i++) {
+        for (j = 0; j < i; j++) {
+            if (!strcmp(disks[i].name, disks[j].name))
+                errx(1, "Duplicate disk name: '%s'", disks[i].name);
+        }
+        if (disks[i].base && disks[i].ram_size)
+            errx(1, "%s: --disk-base cannot be used with a ram disk",
+                    disks[i].path);
+        if (disks[i].base)
+            overlay = 1;
+    }
+    if (overlay && cmdline_direct)
+        errx(1, "--disk-direct cannot be used with --disk-base");
+    if (cmdline_map && (overlay || cmdline_direct))
+        errx(1, "--disk-map cannot be used with --disk-base or --disk-direct");
+    if (cmdline_direct &&
+            posix_memalign((void **)&bounce, 4096, BOUNCE_SIZE) != 0)
+        errx(1, "Could not allocate bounce buffer");
 
-    blkinfo.sector_size = 512;
-    blkinfo.num_sectors = lseek(diskfd, 0, SEEK_END) / 512;
-    blkinfo.rw = 1;
+    for (i = 0; i < ndisks; i++) {
+        disk_open(hv, &disks[i]);
+        memcpy(ukvm_stats->blk[i].name, disks[i].name,
+                sizeof ukvm_stats->blk[i].name);
+    }
+    ukvm_stats->ndisks = ndisks;
 
     assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_BLKINFO,
                 hypercall_blkinfo) == 0);
@@ -126,13 +955,40 @@ static int setup(struct ukvm_hv *hv)
                 hypercall_blkwrite) == 0);
     assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_BLKREAD,
                 hypercall_blkread) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_BLKFLUSH,
+                hypercall_blkflush) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_BLKDISCARD,
+                hypercall_blkdiscard) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_BLKWRITEZEROES,
+                hypercall_blkwritezeroes) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_BLKWRITEV,
+                hypercall_blkwritev) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_BLKREADV,
+                hypercall_blkreadv) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_BLKRING,
+                hypercall_blkring) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_BLKSUBMIT,
+                hypercall_blksubmit) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_BLKOPEN,
+                hypercall_blkopen) == 0);
 
     return 0;
 }
 
 static char *usage(void)
 {
-    return "--disk=IMAGE (file exposed to the unikernel as a raw block device)";
+    return "--disk=[NAME:]IMAGE (file exposed to the unikernel as a raw block\n"
+        "      device; may be repeated, the first is the default device)\n"
+        "    [ --disk=[NAME:]ram:SIZE ] (SIZE MB block device in memory,\n"
+        "      discarded on exit)\n"
+        "    [ --disk-base=BASE ] (the preceding IMAGE is a copy-on-write\n"
+        "      overlay on top of the raw image BASE, created if empty)\n"
+        "    [ --disk-direct ] (bypass the host page cache using O_DIRECT)\n"
+        "    [ --disk-map ] (map IMAGE read-only into guest memory)\n"
+        "    [ --disk-sector-size=512|4096 ] (logical sector size, default\n"
+        "      that of the host device, or 512 for files)\n"
+        "    [ --disk-cache=writeback|writethrough|unsafe ] (host write cache\n"
+        "      mode, default writeback: guest flushes use fdatasync)";
 }
 
 struct ukvm_module ukvm_module_blk = {
@@ -26,151 +26,143 @@
 #include <err.h>
 #include <errno.h>
 #include <fcntl.h>
-#include <ifaddrs.h>
 #include <inttypes.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
-#if defined(__linux__)
-
-/*
- * Linux TAP device specific.
- */
-#include <sys/socket.h>
-#include <linux/if.h>
-#include <linux/if_tun.h>
-
-#elif defined(__FreeBSD__)
-
-#include <net/if.h>
-
-#else /* !__linux__ && !__FreeBSD__ */
-
-#error Unsupported target
+#include "ukvm.h"
+#include "ukvm_net.h"
 
+#include "ukvm_net_tap.c"
+#if defined(__linux__)
+#include "ukvm_net_packet.c"
 #endif
+#include "ukvm_net_socket.c"
+#include "ukvm_net_replay.c"
 
-#include "ukvm.h"
+static struct ukvm_net_backend *backends[] = {
+#if defined(__linux__)
+    &ukvm_net_packet,
+#endif
+    &ukvm_net_socket,
+    &ukvm_net_replay,
+    &ukvm_net_tap,      /* Default, must be last */
+    NULL
+};
 
+static struct ukvm_net_backend *backend;
 static char *netiface;
-static int netfd;
 static struct ukvm_netinfo netinfo;
 static int cmdline_mac = 0;
+static int cmdline_rings = 0;
+static int cmdline_offload = 0;
+static char *cmdline_pcap;
 
 /*
- * Attach to an existing TAP interface named 'ifname'.
+ * Per-queue state. Without --net-queues there is a single queue. With
+ * multiple queues (IFF_MULTI_QUEUE), the host kernel steers received flows to
+ * a queue and the guest chooses a queue for each transmitted flow.
  *
- * Returns -1 and an appropriate errno on failure (ENOENT if the interface does
- * not exist), and the tap device file descriptor on success.
+ * Shared-memory ring state (--net-rings): once the guest has set up the rings
+ * for a queue, all frames on it are moved by (thread); the VCPU thread only
+ * services UKVM_HYPERCALL_NETKICK.
  */
-static int tap_attach(const char *ifname)
-{
+struct netq {
     int fd;
+    struct ukvm_netring *tx, *rx;
+    pthread_t thread;
+    int kickfd[2];      /* guest -> I/O thread doorbell */
+    int notifyfd[2];    /* I/O thread -> UKVM_HYPERCALL_POLL */
+    int spacefd[2];     /* I/O thread -> VCPU waiting on full TX ring */
+    int tx_waiting;
+};
+static struct netq netq[UKVM_NET_QUEUES_MAX];
+static unsigned nqueues = 1;
+static int rings_active;
+/* Next queue to read from for UKVM_HYPERCALL_NETREAD{,V} */
+static unsigned rxq;
 
-    /*
-     * Syntax @<number> indicates a pre-existing open fd, so just pass it
-     * through without any checks.
-     */
-    if (ifname[0] == '@') {
-        fd = atoi(&ifname[1]);
+/*
+ * Write a single byte to the non-blocking pipe (fd). If the pipe is full, a
+ * wakeup is already pending, so EAGAIN can be ignored.
+ */
+static void ring_signal(int fd)
+{
+    char c = 0;
+    int ret;
 
-        if (fcntl(fd, F_SETFL, O_NONBLOCK) == -1)
-            return -1;
+    ret = write(fd, &c, 1);
+    assert(ret == 1 || (ret == -1 && errno == EAGAIN));
+}
 
-        return fd;
-    }
+static void ring_drain(int fd)
+{
+    char buf[64];
 
-    /*
-     * Verify that the interface exists and is up and running. If we don't do
-     * this then we get "create on open" behaviour on most systems which is not
-     * what we want.
-     */
-    struct ifaddrs *ifa, *ifp;
-    int found = 0;
-    int up = 0;
+    while (read(fd, buf, sizeof buf) > 0)
+        ;
+}
 
-    if (getifaddrs(&ifa) == -1)
+static int ring_pipe(int fds[2])
+{
+    if (pipe(fds) == -1)
         return -1;
-    ifp = ifa;
-    while (ifp) {
-        if (strcmp(ifp->ifa_name, ifname) == 0) {
-            found = 1;
-            up = ifp->ifa_flags & (IFF_UP | IFF_RUNNING);
-            break;
-        }
-        ifp = ifp->ifa_next;
-    }
-    freeifaddrs(ifa);
-    if (!found) {
-        errno = ENOENT;
+    if (fcntl(fds[0], F_SETFL, O_NONBLOCK) == -1 ||
+        fcntl(fds[1], F_SETFL, O_NONBLOCK) == -1)
         return -1;
-    }
-
-#if defined(__linux__)
-
-    if (!up) {
-        errno = ENETDOWN;
-        return -1;
-    }
+    return 0;
+}
 
-    int err;
-    struct ifreq ifr;
+/* Uses the helpers above. */
+#include "ukvm_net_pcap.c"
 
-    fd = open("/dev/net/tun", O_RDWR | O_NONBLOCK);
-    if (fd == -1)
-        return -1;
-
-    /*
-     * Initialise ifr for TAP interface.
-     */
-    memset(&ifr, 0, sizeof(ifr));
-    /*
-     * TODO: IFF_NO_PI may silently truncate packets on read().
-     */
-    ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
-    if (strlen(ifname) > IFNAMSIZ) {
-        errno = EINVAL;
-        return -1;
-    }
-    strncpy(ifr.ifr_name, ifname, IFNAMSIZ);
+/*
+ * Frames are read and written through the backend's operations, using the fd
+ * of the queue. Frames written may be queued by the backend until
+ * net_flush() is called. With --net-pcap, all frames transferred are also
+ * recorded in the capture.
+ */
+static ssize_t net_write_frame(int fd, const void *data, size_t len,
+        const struct ukvm_net_hdr *hdr)
+{
+    ssize_t ret = backend->write(fd, data, len, hdr);
 
-    /*
-     * Attach to the tap device; we have already verified that it exists, but
-     * see below.
-     */
-    if (ioctl(fd, TUNSETIFF, (void *)&ifr) == -1) {
-        err = errno;
-        close(fd);
-        errno = err;
-        return -1;
-    }
-    /*
-     * If we got back a different device than the one requested, e.g. because
-     * the caller mistakenly passed in '%d' (yes, that's really in the Linux
-     * API) then fail.
-     */
-    if (strncmp(ifr.ifr_name, ifname, IFNAMSIZ) != 0) {
-        close(fd);
-        errno = EINVAL;
-        return -1;
+    if (ret > 0) {
+        UKVM_STATS_ADD(net.tx_packets, 1);
+        UKVM_STATS_ADD(net.tx_bytes, ret);
+        if (cap.fd != -1)
+            capture_frame(data, ret);
     }
+    return ret;
+}
 
-#elif defined(__FreeBSD__)
-
-    char devname[strlen(ifname) + 6];
-
-    snprintf(devname, sizeof devname, "/dev/%s", ifname);
-    fd = open(devname, O_RDWR | O_NONBLOCK);
-    if (fd == -1)
-        return -1;
+static ssize_t net_read_frame(int fd, void *data, size_t len,
+        struct ukvm_net_hdr *hdr)
+{
+    ssize_t ret = backend->read(fd, data, len, hdr);
 
-#endif
+    if (ret > 0) {
+        UKVM_STATS_ADD(net.rx_packets, 1);
+        UKVM_STATS_ADD(net.rx_bytes, ret);
+        if (cap.fd != -1)
+            capture_frame(data, ret);
+    }
+    return ret;
+}
 
-    return fd;
+static void net_flush(int fd)
+{
+    if (backend->flush)
+        backend->flush(fd);
 }
 
 static void hypercall_netinfo(struct ukvm_hv *hv, ukvm_gpa_t gpa)
@@ -179,6 +171,28 @@ static void hypercall_netinfo(struct ukvm_hv *hv, ukvm_gpa_t gpa)
         UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_netinfo));
 
     memcpy(info->mac_str, netinfo.mac_str, sizeof(netinfo.mac_str));
+    info->features = netinfo.features;
+    info->nqueues = nqueues;
+}
+
+/*
+ * Read a single frame from the next queue which has one available, starting
+ * after the queue last read from so that no queue is starved.
+ */
+static ssize_t net_read_any(void *data, size_t len, struct ukvm_net_hdr *hdr)
+{
+    ssize_t ret = -1;
+    unsigned i;
+
+    for (i = 0; i < nqueues; i++) {
+        unsigned q = rxq;
+
+        rxq = (rxq + 1) % nqueues;
+        ret = net_read_frame(netq[q].fd, data, len, hdr);
+        if (ret != 0 && !(ret == -1 && errno == EAGAIN))
+            break;
+    }
+    return ret;
 }
 
 static void hypercall_netwrite(struct ukvm_hv *hv, ukvm_gpa_t gpa)
@@ -187,8 +201,21 @@ static void hypercall_netwrite(struct ukvm_hv *hv, ukvm_gpa_t gpa)
         UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_netwrite));
     int ret;
 
-    ret = write(netfd, UKVM_CHECKED_GPA_P(hv, wr->data, wr->len), wr->len);
+    if (rings_active) {
+        wr->ret = -1;
+        return;
+    }
+
+    if (wr->hdr && vnet_hdr_len == 0) {
+        wr->ret = -1;
+        return;
+    }
+    ret = net_write_frame(netq[0].fd,
+            UKVM_CHECKED_GPA_P(hv, wr->data, wr->len), wr->len,
+            wr->hdr ? UKVM_CHECKED_GPA_P(hv, wr->hdr,
+                sizeof (struct ukvm_net_hdr)) : NULL);
     assert(wr->len == ret);
+    net_flush(netq[0].fd);
     wr->ret = 0;
 }
 
@@ -198,7 +225,18 @@ static void hypercall_netread(struct ukvm_hv *hv, ukvm_gpa_t gpa)
         UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_netread));
     int ret;
 
-    ret = read(netfd, UKVM_CHECKED_GPA_P(hv, rd->data, rd->len), rd->len);
+    if (rings_active) {
+        rd->ret = -1;
+        return;
+    }
+
+    if (rd->hdr && vnet_hdr_len == 0) {
+        rd->ret = -1;
+        return;
+    }
+    ret = net_read_any(UKVM_CHECKED_GPA_P(hv, rd->data, rd->len), rd->len,
+            rd->hdr ? UKVM_CHECKED_GPA_P(hv, rd->hdr,
+                sizeof (struct ukvm_net_hdr)) : NULL);
     if ((ret == 0) ||
         (ret == -1 && errno == EAGAIN)) {
         rd->ret = -1;
@@ -209,10 +247,268 @@ static void hypercall_netread(struct ukvm_hv *hv, ukvm_gpa_t gpa)
     rd->ret = 0;
 }
 
+static void hypercall_netwritev(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    struct ukvm_netwritev *wr =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_netwritev));
+    struct ukvm_netiov *iov;
+    size_t i;
+    int ret;
+
+    if (rings_active || wr->iovcnt > UKVM_NETIOV_MAX) {
+        wr->ret = -1;
+        return;
+    }
+    iov = UKVM_CHECKED_GPA_P(hv, wr->iov,
+            wr->iovcnt * sizeof (struct ukvm_netiov));
+
+    /*
+     * A TAP device consumes exactly one frame per write(), so writev() cannot
+     * be used here as it would coalesce all descriptors into a single frame.
+     */
+    for (i = 0; i < wr->iovcnt; i++) {
+        size_t len = iov[i].len;
+
+        ret = net_write_frame(netq[0].fd,
+                UKVM_CHECKED_GPA_P(hv, iov[i].data, len), len, NULL);
+        assert(len == ret);
+    }
+    net_flush(netq[0].fd);
+    wr->nframes = i;
+    wr->ret = 0;
+}
+
+static void hypercall_netreadv(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    struct ukvm_netreadv *rd =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_netreadv));
+    struct ukvm_netiov *iov;
+    size_t i;
+    int ret;
+
+    if (rings_active || rd->iovcnt > UKVM_NETIOV_MAX) {
+        rd->ret = -1;
+        return;
+    }
+    iov = UKVM_CHECKED_GPA_P(hv, rd->iov,
+            rd->iovcnt * sizeof (struct ukvm_netiov));
+
+    /*
+     * Drain as many frames as are available without blocking, up to the
+     * number of descriptors supplied by the guest.
+     */
+    for (i = 0; i < rd->iovcnt; i++) {
+        size_t len = iov[i].len;
+
+        ret = net_read_any(UKVM_CHECKED_GPA_P(hv, iov[i].data, len), len,
+                NULL);
+        if ((ret == 0) ||
+            (ret == -1 && errno == EAGAIN))
+            break;
+        assert(ret > 0);
+        iov[i].len = ret;
+    }
+    rd->nframes = i;
+    rd->ret = (i > 0) ? 0 : -1;
+}
+
+/*
+ * Move all frames produced by the guest on the TX ring of (q) to the network
+ * device. Returns 1 if any work was done.
+ */
+static int ring_do_tx(struct netq *q)
+{
+    struct ukvm_netring *tx = q->tx;
+    uint32_t cons = tx->cons;
+    uint32_t prod = __atomic_load_n(&tx->prod, __ATOMIC_ACQUIRE);
+    int ret;
+
+    if (cons == prod)
+        return 0;
+
+    while (cons != prod) {
+        struct ukvm_netring_slot *slot = &tx->slot[cons % UKVM_NETRING_SLOTS];
+        size_t len = slot->len;
+
+        if (len > UKVM_NETRING_FRAME_SIZE)
+            errx(1, "Invalid guest frame length: %zu", len);
+        ret = net_write_frame(q->fd, slot->data, len, NULL);
+        assert(ret == len);
+        cons++;
+        if (cons == prod)
+            prod = __atomic_load_n(&tx->prod, __ATOMIC_ACQUIRE);
+    }
+    net_flush(q->fd);
+    __atomic_store_n(&tx->cons, cons, __ATOMIC_RELEASE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&q->tx_waiting, __ATOMIC_ACQUIRE))
+        ring_signal(q->spacefd[1]);
+    return 1;
+}
+
+/*
+ * Move frames from the network device to the RX ring of (q) until either no
+ * more frames are available or the ring is full. Returns -1 if the ring is
+ * full, 1 if any work was done, and 0 otherwise.
+ */
+static int ring_do_rx(struct netq *q)
+{
+    struct ukvm_netring *rx = q->rx;
+    uint32_t prod = rx->prod;
+    uint32_t cons = __atomic_load_n(&rx->cons, __ATOMIC_ACQUIRE);
+    int work = 0;
+    int ret;
+
+    for (;;) {
+        if (prod - cons == UKVM_NETRING_SLOTS) {
+            /*
+             * Ring looks full; re-check after a full barrier, pairing with
+             * the barrier in the guest after it consumes a frame. If it is
+             * still full the guest will kick us once it has made space.
+             */
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            cons = __atomic_load_n(&rx->cons, __ATOMIC_ACQUIRE);
+            if (prod - cons == UKVM_NETRING_SLOTS)
+                return -1;
+        }
+
+        struct ukvm_netring_slot *slot = &rx->slot[prod % UKVM_NETRING_SLOTS];
+        ret = net_read_frame(q->fd, slot->data, UKVM_NETRING_FRAME_SIZE, NULL);
+        if ((ret == 0) ||
+            (ret == -1 && errno == EAGAIN))
+            return work;
+        assert(ret > 0);
+        slot->len = ret;
+
+        __atomic_store_n(&rx->prod, prod + 1, __ATOMIC_RELEASE);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        cons = __atomic_load_n(&rx->cons, __ATOMIC_ACQUIRE);
+        if (cons == prod)
+            ring_signal(q->notifyfd[1]);
+        prod++;
+        work = 1;
+    }
+}
+
+static void *ring_thread_fn(void *arg)
+{
+    struct netq *q = arg;
+    struct pollfd pfd[2];
+    int rx_full = 0;
+
+    pfd[0].fd = q->fd;
+    pfd[1].fd = q->kickfd[0];
+    pfd[1].events = POLLIN;
+
+    for (;;) {
+        int tx_work, rx_work;
+
+        tx_work = ring_do_tx(q);
+        rx_work = ring_do_rx(q);
+        rx_full = (rx_work == -1);
+        if (tx_work || rx_work == 1)
+            continue;
+
+        /*
+         * About to sleep. Re-check the TX ring after a full barrier, pairing
+         * with the barrier in the guest after it produces a frame. If it is
+         * still empty the guest will kick us for the next frame.
+         */
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&q->tx->prod, __ATOMIC_ACQUIRE) != q->tx->cons)
+            continue;
+
+        pfd[0].events = rx_full ? 0 : POLLIN;
+        if (poll(pfd, 2, -1) == -1 && errno != EINTR)
+            err(1, "poll");
+        if (pfd[1].revents & POLLIN)
+            ring_drain(q->kickfd[0]);
+    }
+
+    return NULL;
+}
+
+static void hypercall_netrings(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    struct ukvm_netrings *r =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_netrings));
+    struct netq *q;
+    sigset_t all, old;
+
+    if (!cmdline_rings || r->queue >= nqueues || netq[r->queue].tx != NULL) {
+        r->ret = -1;
+        return;
+    }
+    q = &netq[r->queue];
+    q->tx = UKVM_CHECKED_GPA_P(hv, r->tx, sizeof (struct ukvm_netring));
+    q->rx = UKVM_CHECKED_GPA_P(hv, r->rx, sizeof (struct ukvm_netring));
+    rings_active = 1;
+
+    if (ring_pipe(q->kickfd) == -1 || ring_pipe(q->notifyfd) == -1 ||
+            ring_pipe(q->spacefd) == -1)
+        err(1, "Could not create ring notification pipes");
+    /*
+     * From now on the guest is woken from UKVM_HYPERCALL_POLL by the I/O
+     * thread, not by the network device directly.
+     */
+    if (ukvm_core_replace_pollfd(q->fd, q->notifyfd[0], ring_drain) == -1)
+        errx(1, "Could not replace network poll fd");
+
+    /*
+     * Signals must continue to be delivered to the VCPU thread only.
+     */
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+    if (pthread_create(&q->thread, NULL, ring_thread_fn, q) != 0)
+        errx(1, "Could not create network I/O thread");
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+    r->ret = 0;
+}
+
+static void hypercall_netkick(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    struct ukvm_netkick *k =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_netkick));
+    struct netq *q;
+
+    if (k->queue >= nqueues || netq[k->queue].tx == NULL)
+        return;
+    q = &netq[k->queue];
+    ring_signal(q->kickfd[1]);
+
+    /*
+     * If the guest is waiting for space on a full TX ring, block until the
+     * I/O thread has consumed some frames rather than have the guest spin.
+     */
+    __atomic_store_n(&q->tx_waiting, 1, __ATOMIC_RELEASE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&q->tx->prod, __ATOMIC_ACQUIRE) -
+            __atomic_load_n(&q->tx->cons, __ATOMIC_ACQUIRE) ==
+            UKVM_NETRING_SLOTS) {
+        struct pollfd pfd = { .fd = q->spacefd[0], .events = POLLIN };
+
+        if (poll(&pfd, 1, -1) == -1 && errno != EINTR)
+            err(1, "poll");
+    }
+    __atomic_store_n(&q->tx_waiting, 0, __ATOMIC_RELEASE);
+    ring_drain(q->spacefd[0]);
+}
+
 static int handle_cmdarg(char *cmdarg)
 {
     if (!strncmp("--net=", cmdarg, 6)) {
-        netiface = cmdarg + 6;
+        const char *arg = cmdarg + 6;
+
+        for (struct ukvm_net_backend **b = backends; *b; b++) {
+            size_t n = (*b)->prefix ? strlen((*b)->prefix) : 0;
+
+            if (n == 0 || !strncmp((*b)->prefix, arg, n)) {
+                backend = *b;
+                netiface = cmdarg + 6 + n;
+                break;
+            }
+        }
         return 0;
     } else if (!strncmp("--net-mac=", cmdarg, 10)) {
         const char *macptr = cmdarg + 10;
@@ -227,6 +523,37 @@ static int handle_cmdarg(char *cmdarg)
         snprintf(netinfo.mac_str, sizeof(netinfo.mac_str), "%s", macptr);
         cmdline_mac = 1;
         return 0;
+    } else if (!strcmp("--net-rings", cmdarg)) {
+        cmdline_rings = 1;
+        return 0;
+    } else if (!strcmp("--net-offload", cmdarg)) {
+        cmdline_offload = 1;
+        return 0;
+    } else if (!strncmp("--net-queues=", cmdarg, 13)) {
+        char *end;
+        unsigned long n = strtoul(cmdarg + 13, &end, 10);
+
+        if (*end != '\0' || n < 1 || n > UKVM_NET_QUEUES_MAX) {
+            warnx("Invalid number of queues: %s (must be 1..%d)",
+                  cmdarg + 13, UKVM_NET_QUEUES_MAX);
+            return -1;
+        }
+        nqueues = n;
+        return 0;
+    } else if (!strncmp("--net-pcap=", cmdarg, 11)) {
+        cmdline_pcap = cmdarg + 11;
+        return 0;
+    } else if (!strncmp("--net-pcap-snaplen=", cmdarg, 19)) {
+        char *end;
+        unsigned long n = strtoul(cmdarg + 19, &end, 10);
+
+        if (*end != '\0' || n < 1 || n > 65535) {
+            warnx("Invalid capture snaplen: %s (must be 1..65535)",
+                  cmdarg + 19);
+            return -1;
+        }
+        cap.snaplen = n;
+        return 0;
     } else {
         return -1;
     }
@@ -237,12 +564,34 @@ static int setup(struct ukvm_hv *hv)
     if (netiface == NULL)
         return -1;
 
-    /* attach to requested tap interface */
-    netfd = tap_attach(netiface);
-    if (netfd < 0) {
+    /*
+     * Each queue is served by its own I/O thread, so multiple queues imply
+     * rings.
+     */
+    if (nqueues > 1)
+        cmdline_rings = 1;
+    /*
+     * The ring I/O thread moves raw frames only, so cannot carry offload
+     * headers.
+     */
+    if (cmdline_offload && cmdline_rings)
+        errx(1, "--net-offload cannot be used with --net-rings or "
+                "--net-queues");
+
+    if (cmdline_offload && !(backend->flags & UKVM_NET_BACKEND_F_OFFLOAD))
+        errx(1, "--net-offload is not supported by this network backend");
+    if (nqueues > 1 && !(backend->flags & UKVM_NET_BACKEND_F_MULTIQUEUE))
+        errx(1, "--net-queues is not supported by this network backend");
+
+    int fds[UKVM_NET_QUEUES_MAX];
+
+    if (backend->attach(netiface, fds, nqueues, cmdline_offload) == -1)
         err(1, "Could not attach interface: %s", netiface);
-        exit(1);
-    }
+    for (unsigned i = 0; i < nqueues; i++)
+        netq[i].fd = fds[i];
+
+    if (cmdline_pcap)
+        capture_init(cmdline_pcap);
 
     if (!cmdline_mac) {
         /* generate a random, locally-administered and unicast MAC address */
@@ -271,7 +620,22 @@ static int setup(struct ukvm_hv *hv)
                 hypercall_netwrite) == 0);
     assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_NETREAD,
                 hypercall_netread) == 0);
-    assert(ukvm_core_register_pollfd(netfd) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_NETWRITEV,
+                hypercall_netwritev) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_NETREADV,
+                hypercall_netreadv) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_NETRINGS,
+                hypercall_netrings) == 0);
+    assert(ukvm_core_register_hypercall(UKVM_HYPERCALL_NETKICK,
+                hypercall_netkick) == 0);
+    for (unsigned i = 0; i < nqueues; i++)
+        assert(ukvm_core_register_pollfd(netq[i].fd) == 0);
+
+    if (cmdline_rings)
+        netinfo.features |= UKVM_NET_F_RINGS;
+    if (cmdline_offload)
+        netinfo.features |= UKVM_NET_F_CSUM | UKVM_NET_F_TSO4 |
+            UKVM_NET_F_TSO6;
 
     return 0;
 }
@@ -279,7 +643,17 @@ static int setup(struct ukvm_hv *hv)
 static char *usage(void)
 {
     return "--net=TAP (host tap device for guest network interface or @NN tap fd)\n"
-        "    [ --net-mac=HWADDR ] (guest MAC address)";
+#if defined(__linux__)
+        "    or --net=packet:IFNAME (host interface, using an AF_PACKET socket)\n"
+#endif
+        "    or --net=socket:PATH (connected AF_UNIX SOCK_SEQPACKET socket or @NN fd)\n"
+        "    or --net=replay:FILE.pcap[,loop] (replay frames to guest, count sent frames)\n"
+        "    [ --net-mac=HWADDR ] (guest MAC address)\n"
+        "    [ --net-rings ] (use shared-memory rings and a host I/O thread)\n"
+        "    [ --net-offload ] (enable checksum and segmentation offloads)\n"
+        "    [ --net-queues=N ] (use N TAP queues, implies --net-rings)\n"
+        "    [ --net-pcap=FILE ] (capture guest network traffic to FILE)\n"
+        "    [ --net-pcap-snaplen=N ] (capture at most N bytes of each frame)";
 }
 
 struct ukvm_module ukvm_module_net = {
@@ -0,0 +1,65 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_names.h: Human-readable hypercall names, for use by tools.
+ */
+
+#ifndef UKVM_NAMES_H
+#define UKVM_NAMES_H
+
+#define UKVM_HOST
+#include "ukvm_guest.h"
+
+static const char *ukvm_hypercall_names[UKVM_HYPERCALL_MAX] = {
+    [UKVM_HYPERCALL_WALLTIME] = "walltime",
+    [UKVM_HYPERCALL_PUTS] = "puts",
+    [UKVM_HYPERCALL_POLL] = "poll",
+    [UKVM_HYPERCALL_BLKINFO] = "blkinfo",
+    [UKVM_HYPERCALL_BLKWRITE] = "blkwrite",
+    [UKVM_HYPERCALL_BLKREAD] = "blkread",
+    [UKVM_HYPERCALL_NETINFO] = "netinfo",
+    [UKVM_HYPERCALL_NETWRITE] = "netwrite",
+    [UKVM_HYPERCALL_NETREAD] = "netread",
+    [UKVM_HYPERCALL_HALT] = "halt",
+    [UKVM_HYPERCALL_NETWRITEV] = "netwritev",
+    [UKVM_HYPERCALL_NETREADV] = "netreadv",
+    [UKVM_HYPERCALL_NETRINGS] = "netrings",
+    [UKVM_HYPERCALL_NETKICK] = "netkick",
+    [UKVM_HYPERCALL_BLKWRITEV] = "blkwritev",
+    [UKVM_HYPERCALL_BLKREADV] = "blkreadv",
+    [UKVM_HYPERCALL_BLKRING] = "blkring",
+    [UKVM_HYPERCALL_BLKSUBMIT] = "blksubmit",
+    [UKVM_HYPERCALL_BLKFLUSH] = "blkflush",
+    [UKVM_HYPERCALL_BLKDISCARD] = "blkdiscard",
+    [UKVM_HYPERCALL_BLKWRITEZEROES] = "blkwritezeroes",
+    [UKVM_HYPERCALL_BLKOPEN] = "blkopen",
+    [UKVM_HYPERCALL_SNAPSHOT] = "snapshot",
+};
+
+/*
+ * Returns the name of hypercall (nr), or NULL if unknown.
+ */
+static inline const char *ukvm_hypercall_name(unsigned nr)
+{
+    return nr < UKVM_HYPERCALL_MAX ? ukvm_hypercall_names[nr] : NULL;
+}
+
+#endif /* UKVM_NAMES_H */
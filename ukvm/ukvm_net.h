@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_net.h: Interface between the network module and its backends.
+ */
+
+#ifndef UKVM_NET_H
+#define UKVM_NET_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+/*
+ * A network backend moves frames between the guest and the host. It is
+ * selected with --net=PREFIX:ARG, or --net=ARG for the default (TAP) backend.
+ *
+ * Each queue is identified by the fd returned for it by attach(), which must
+ * be pollable and become readable when frames can be read from the queue.
+ * read() and write() transfer a single frame and follow the conventions of
+ * read(2) and write(2), returning -1 with errno set to EAGAIN if no frame is
+ * available. write() may queue frames until flush() is called.
+ *
+ * Backends which do not set UKVM_NET_BACKEND_F_OFFLOAD are only ever passed a
+ * NULL (hdr); those which do not set UKVM_NET_BACKEND_F_MULTIQUEUE are only
+ * ever attached with a single queue.
+ */
+#define UKVM_NET_BACKEND_F_OFFLOAD      (1U << 0)
+#define UKVM_NET_BACKEND_F_MULTIQUEUE   (1U << 1)
+
+struct ukvm_net_backend {
+    const char *prefix;                     /* NULL for the default */
+    unsigned flags;
+
+    /*
+     * Attach (nqueues) queues to (arg), storing their fds in (fds). (offload)
+     * is set if --net-offload was given. Returns 0 on success, -1 and an
+     * appropriate errno on failure.
+     */
+    int (*attach)(const char *arg, int *fds, unsigned nqueues, int offload);
+    ssize_t (*read)(int fd, void *data, size_t len, struct ukvm_net_hdr *hdr);
+    ssize_t (*write)(int fd, const void *data, size_t len,
+            const struct ukvm_net_hdr *hdr);
+    void (*flush)(int fd);                  /* Optional */
+};
+
+/*
+ * pcap file format, used by the replay backend and by --net-pcap.
+ */
+#define PCAP_MAGIC          0xa1b2c3d4
+#define PCAP_MAGIC_NSEC     0xa1b23c4d
+#define PCAP_VERSION_MAJOR  2
+#define PCAP_VERSION_MINOR  4
+#define PCAP_LINKTYPE_ETHERNET 1
+
+struct pcap_file_hdr {
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    int32_t thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t linktype;
+};
+
+struct pcap_rec_hdr {
+    uint32_t ts_sec;
+    uint32_t ts_frac;
+    uint32_t incl_len;
+    uint32_t orig_len;
+};
+
+#endif /* UKVM_NET_H */
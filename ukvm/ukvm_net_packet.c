@@ -0,0 +1,277 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_net_packet.c: AF_PACKET network backend (--net=packet:IFNAME).
+ *
+ * This file is included from ukvm_module_net.c.
+ */
+
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <linux/if.h>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
+
+/*
+ * Frames are moved using PACKET_MMAP TPACKET_V3 rings. The kernel fills the
+ * RX ring a block (of many frames) at a time and hands each block over once
+ * it is full or PACKET_RX_BLK_TOV ms have passed. TX frames are queued on the
+ * TX ring and handed to the kernel with a single send() per batch
+ * (packet_flush()), so no syscalls are made per frame.
+ */
+#define PACKET_FRAME_SIZE   2048
+#define PACKET_BLOCK_SIZE   (1 << 18)
+#define PACKET_RX_BLOCKS    16
+#define PACKET_TX_BLOCKS    4
+#define PACKET_RX_BLK_TOV   1
+
+static struct {
+    uint8_t *rx_ring, *tx_ring;
+    /* RX: current block, next frame in it and frames left in it */
+    unsigned rx_block;
+    struct tpacket3_hdr *rx_next;
+    unsigned rx_left;
+    /* TX: next frame slot and number of frames queued since last flush */
+    unsigned tx_frame, tx_frames, tx_queued;
+} pkt;
+
+static int packet_attach(const char *ifname, int *fds,
+        unsigned nqueues __attribute__((unused)),
+        int offload __attribute__((unused)))
+{
+    struct tpacket_req3 req;
+    struct sockaddr_ll sll;
+    struct packet_mreq mreq;
+    struct ifreq ifr;
+    int v = TPACKET_V3, one = 1;
+    size_t rx_size, tx_size;
+    int fd;
+
+    if (strlen(ifname) >= IFNAMSIZ) {
+        errno = EINVAL;
+        return -1;
+    }
+    fd = socket(AF_PACKET, SOCK_RAW, htons(ETH_P_ALL));
+    if (fd == -1)
+        return -1;
+    memset(&ifr, 0, sizeof ifr);
+    strncpy(ifr.ifr_name, ifname, IFNAMSIZ);
+    if (ioctl(fd, SIOCGIFINDEX, &ifr) == -1)
+        goto fail;
+    if (fcntl(fd, F_SETFL, O_NONBLOCK) == -1)
+        goto fail;
+    if (setsockopt(fd, SOL_PACKET, PACKET_VERSION, &v, sizeof v) == -1)
+        goto fail;
+    /*
+     * Frames sent by the guest should not be looped back to it. Best effort,
+     * as older kernels do not support this; see also packet_read().
+     */
+#ifdef PACKET_IGNORE_OUTGOING
+    (void)setsockopt(fd, SOL_PACKET, PACKET_IGNORE_OUTGOING, &one, sizeof one);
+#endif
+    (void)setsockopt(fd, SOL_PACKET, PACKET_QDISC_BYPASS, &one, sizeof one);
+
+    memset(&req, 0, sizeof req);
+    req.tp_block_size = PACKET_BLOCK_SIZE;
+    req.tp_block_nr = PACKET_RX_BLOCKS;
+    req.tp_frame_size = PACKET_FRAME_SIZE;
+    req.tp_frame_nr = (PACKET_BLOCK_SIZE / PACKET_FRAME_SIZE) * PACKET_RX_BLOCKS;
+    req.tp_retire_blk_tov = PACKET_RX_BLK_TOV;
+    if (setsockopt(fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof req) == -1)
+        goto fail;
+    rx_size = (size_t)PACKET_BLOCK_SIZE * PACKET_RX_BLOCKS;
+
+    memset(&req, 0, sizeof req);
+    req.tp_block_size = PACKET_BLOCK_SIZE;
+    req.tp_block_nr = PACKET_TX_BLOCKS;
+    req.tp_frame_size = PACKET_FRAME_SIZE;
+    req.tp_frame_nr = (PACKET_BLOCK_SIZE / PACKET_FRAME_SIZE) * PACKET_TX_BLOCKS;
+    if (setsockopt(fd, SOL_PACKET, PACKET_TX_RING, &req, sizeof req) == -1)
+        goto fail;
+    tx_size = (size_t)PACKET_BLOCK_SIZE * PACKET_TX_BLOCKS;
+    pkt.tx_frames = req.tp_frame_nr;
+
+    /*
+     * Both rings are mapped with a single mmap(), RX first.
+     */
+    pkt.rx_ring = mmap(NULL, rx_size + tx_size, PROT_READ | PROT_WRITE,
+            MAP_SHARED, fd, 0);
+    if (pkt.rx_ring == MAP_FAILED)
+        goto fail;
+    pkt.tx_ring = pkt.rx_ring + rx_size;
+
+    memset(&sll, 0, sizeof sll);
+    sll.sll_family = AF_PACKET;
+    sll.sll_protocol = htons(ETH_P_ALL);
+    sll.sll_ifindex = ifr.ifr_ifindex;
+    if (bind(fd, (struct sockaddr *)&sll, sizeof sll) == -1)
+        goto fail;
+
+    /*
+     * The guest has its own MAC address, so must see all traffic.
+     */
+    memset(&mreq, 0, sizeof mreq);
+    mreq.mr_ifindex = ifr.ifr_ifindex;
+    mreq.mr_type = PACKET_MR_PROMISC;
+    if (setsockopt(fd, SOL_PACKET, PACKET_ADD_MEMBERSHIP, &mreq,
+                sizeof mreq) == -1)
+        goto fail;
+
+    fds[0] = fd;
+    return 0;
+
+fail:
+    v = errno;
+    close(fd);
+    errno = v;
+    return -1;
+}
+
+static struct tpacket_block_desc *packet_rx_block(unsigned i)
+{
+    return (struct tpacket_block_desc *)
+        (pkt.rx_ring + (size_t)i * PACKET_BLOCK_SIZE);
+}
+
+static struct tpacket3_hdr *packet_tx_frame(unsigned i)
+{
+    return (struct tpacket3_hdr *)
+        (pkt.tx_ring + (size_t)i * PACKET_FRAME_SIZE);
+}
+
+/*
+ * If the kernel flagged a block as having followed a drop, collect (and
+ * reset) the socket's drop count.
+ */
+static void packet_account_drops(int fd, struct tpacket_block_desc *bd)
+{
+    struct tpacket_stats_v3 st;
+    socklen_t sz = sizeof st;
+
+    if (!(bd->hdr.bh1.block_status & TP_STATUS_LOSING))
+        return;
+    if (getsockopt(fd, SOL_PACKET, PACKET_STATISTICS, &st, &sz) == 0)
+        UKVM_STATS_ADD(net.rx_drops, st.tp_drops);
+}
+
+static ssize_t packet_read(int fd, void *data, size_t len,
+        struct ukvm_net_hdr *hdr __attribute__((unused)))
+{
+    for (;;) {
+        struct tpacket_block_desc *bd = packet_rx_block(pkt.rx_block);
+        struct tpacket3_hdr *ppd;
+        struct sockaddr_ll *sll;
+        size_t n;
+
+        if (pkt.rx_left == 0) {
+            if (!(__atomic_load_n(&bd->hdr.bh1.block_status,
+                            __ATOMIC_ACQUIRE) & TP_STATUS_USER)) {
+                errno = EAGAIN;
+                return -1;
+            }
+            packet_account_drops(fd, bd);
+            pkt.rx_left = bd->hdr.bh1.num_pkts;
+            pkt.rx_next = (struct tpacket3_hdr *)
+                ((uint8_t *)bd + bd->hdr.bh1.offset_to_first_pkt);
+        }
+
+        ppd = pkt.rx_next;
+        sll = (struct sockaddr_ll *)
+            ((uint8_t *)ppd + TPACKET_ALIGN(sizeof (struct tpacket3_hdr)));
+        n = 0;
+        if (pkt.rx_left > 0 && sll->sll_pkttype != PACKET_OUTGOING) {
+            n = ppd->tp_snaplen;
+            if (n > len)
+                n = len;
+            memcpy(data, (uint8_t *)ppd + ppd->tp_mac, n);
+        }
+
+        /*
+         * Return the block to the kernel once all its frames are consumed.
+         */
+        if (pkt.rx_left > 0) {
+            pkt.rx_next = (struct tpacket3_hdr *)
+                ((uint8_t *)ppd + ppd->tp_next_offset);
+            pkt.rx_left--;
+        }
+        if (pkt.rx_left == 0) {
+            __atomic_store_n(&bd->hdr.bh1.block_status, TP_STATUS_KERNEL,
+                    __ATOMIC_RELEASE);
+            pkt.rx_block = (pkt.rx_block + 1) % PACKET_RX_BLOCKS;
+        }
+        if (n > 0)
+            return n;
+    }
+}
+
+/*
+ * Hand all queued TX frames to the kernel.
+ */
+static void packet_flush(int fd)
+{
+    if (pkt.tx_queued == 0)
+        return;
+    if (send(fd, NULL, 0, MSG_DONTWAIT) == -1 && errno != EAGAIN &&
+            errno != ENOBUFS)
+        err(1, "packet: send");
+    pkt.tx_queued = 0;
+}
+
+static ssize_t packet_write(int fd, const void *data, size_t len,
+        const struct ukvm_net_hdr *hdr __attribute__((unused)))
+{
+    struct tpacket3_hdr *ppd = packet_tx_frame(pkt.tx_frame);
+    size_t off = TPACKET_ALIGN(sizeof (struct tpacket3_hdr));
+
+    if (len > PACKET_FRAME_SIZE - off) {
+        errno = EMSGSIZE;
+        return -1;
+    }
+    /*
+     * If the next slot is still in use by the kernel, flush and wait for it.
+     */
+    while (__atomic_load_n(&ppd->tp_status, __ATOMIC_ACQUIRE) &
+            (TP_STATUS_SEND_REQUEST | TP_STATUS_SENDING)) {
+        struct pollfd pfd = { .fd = fd, .events = POLLOUT };
+
+        packet_flush(fd);
+        if (poll(&pfd, 1, -1) == -1 && errno != EINTR)
+            err(1, "poll");
+    }
+
+    memcpy((uint8_t *)ppd + off, data, len);
+    ppd->tp_len = len;
+    ppd->tp_next_offset = 0;
+    __atomic_store_n(&ppd->tp_status, TP_STATUS_SEND_REQUEST,
+            __ATOMIC_RELEASE);
+    pkt.tx_frame = (pkt.tx_frame + 1) % pkt.tx_frames;
+    pkt.tx_queued++;
+    return len;
+}
+
+
+static struct ukvm_net_backend ukvm_net_packet = {
+    .prefix = "packet:",
+    .attach = packet_attach,
+    .read = packet_read,
+    .write = packet_write,
+    .flush = packet_flush
+};
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_net_pcap.c: Packet capture of guest network traffic (--net-pcap).
+ *
+ * Every frame sent or received by the guest is appended, with a pcap record
+ * header, to an in-memory byte ring. A capture thread writes the ring out to
+ * the capture file in large chunks. The VCPU and network I/O threads never
+ * wait for the capture file: if the ring is full the frame is dropped from
+ * the capture and counted.
+ *
+ * This file is included from ukvm_module_net.c.
+ */
+
+#include <sys/time.h>
+
+#define CAPTURE_RING_SIZE   (8 * 1024 * 1024)
+#define CAPTURE_WRITE_MAX   (1024 * 1024)
+
+static struct {
+    int fd;
+    uint32_t snaplen;
+    uint8_t *ring;
+    /*
+     * (head) and (tail) are free-running byte counts. Producers append at
+     * (head), serialized by (lock); the capture thread consumes from (tail).
+     */
+    uint64_t head, tail;
+    pthread_mutex_t lock;
+    pthread_t thread;
+    int wakefd[2];
+    int stop;
+    uint64_t frames, drops;
+} cap = {
+    .fd = -1,
+    .snaplen = 65535,
+    .lock = PTHREAD_MUTEX_INITIALIZER
+};
+
+static void capture_copy(uint64_t pos, const void *data, size_t len)
+{
+    size_t off = pos % CAPTURE_RING_SIZE;
+    size_t n = CAPTURE_RING_SIZE - off;
+
+    if (n > len)
+        n = len;
+    memcpy(cap.ring + off, data, n);
+    memcpy(cap.ring, (const uint8_t *)data + n, len - n);
+}
+
+/*
+ * Record a frame of (len) bytes in the capture.
+ */
+static void capture_frame(const void *data, size_t len)
+{
+    struct pcap_rec_hdr rec;
+    struct timeval tv;
+    uint64_t head, tail;
+    size_t incl = len < cap.snaplen ? len : cap.snaplen;
+
+    gettimeofday(&tv, NULL);
+    rec.ts_sec = tv.tv_sec;
+    rec.ts_frac = tv.tv_usec;
+    rec.incl_len = incl;
+    rec.orig_len = len;
+
+    pthread_mutex_lock(&cap.lock);
+    head = cap.head;
+    tail = __atomic_load_n(&cap.tail, __ATOMIC_ACQUIRE);
+    if (CAPTURE_RING_SIZE - (head - tail) < sizeof rec + incl) {
+        cap.drops++;
+        pthread_mutex_unlock(&cap.lock);
+        return;
+    }
+    capture_copy(head, &rec, sizeof rec);
+    capture_copy(head + sizeof rec, data, incl);
+    __atomic_store_n(&cap.head, head + sizeof rec + incl, __ATOMIC_RELEASE);
+    cap.frames++;
+    pthread_mutex_unlock(&cap.lock);
+
+    /*
+     * Wake the capture thread once a write's worth of data is pending,
+     * otherwise it will pick the data up on its next periodic flush.
+     */
+    if (head - tail < CAPTURE_WRITE_MAX &&
+            head + sizeof rec + incl - tail >= CAPTURE_WRITE_MAX)
+        ring_signal(cap.wakefd[1]);
+}
+
+/*
+ * Write out everything in the ring up to the current head. Returns -1 if the
+ * capture file could not be written.
+ */
+static int capture_flush(void)
+{
+    uint64_t head = __atomic_load_n(&cap.head, __ATOMIC_ACQUIRE);
+    uint64_t tail = cap.tail;
+
+    while (tail != head) {
+        size_t off = tail % CAPTURE_RING_SIZE;
+        size_t n = CAPTURE_RING_SIZE - off;
+        ssize_t ret;
+
+        if (n > head - tail)
+            n = head - tail;
+        ret = write(cap.fd, cap.ring + off, n);
+        if (ret == -1 && errno == EINTR)
+            continue;
+        if (ret <= 0)
+            return -1;
+        tail += ret;
+        __atomic_store_n(&cap.tail, tail, __ATOMIC_RELEASE);
+    }
+    return 0;
+}
+
+static void *capture_thread_fn(void *arg __attribute__((unused)))
+{
+    struct pollfd pfd = { .fd = cap.wakefd[0], .events = POLLIN };
+
+    /*
+     * If the capture file cannot be written, stop; the ring then fills up
+     * and further frames are counted as dropped.
+     */
+    while (!__atomic_load_n(&cap.stop, __ATOMIC_ACQUIRE)) {
+        if (poll(&pfd, 1, 100) == -1 && errno != EINTR)
+            break;
+        ring_drain(cap.wakefd[0]);
+        if (capture_flush() == -1)
+            goto out_err;
+    }
+    if (capture_flush() == -1)
+        goto out_err;
+    return NULL;
+
+out_err:
+    warn("Could not write to capture file");
+    return NULL;
+}
+
+/*
+ * Called at exit. The capture lock is not taken here, as the VCPU thread may
+ * have been interrupted by a signal while holding it; a frame still being
+ * recorded at that point is simply not written out.
+ */
+static void capture_fini(void)
+{
+    __atomic_store_n(&cap.stop, 1, __ATOMIC_RELEASE);
+    ring_signal(cap.wakefd[1]);
+    pthread_join(cap.thread, NULL);
+    close(cap.fd);
+    if (cap.drops)
+        warnx("net capture: %" PRIu64 " frames captured, %" PRIu64
+                " dropped", cap.frames, cap.drops);
+}
+
+static void capture_init(const char *path)
+{
+    struct pcap_file_hdr fh = {
+        .magic = PCAP_MAGIC,
+        .version_major = PCAP_VERSION_MAJOR,
+        .version_minor = PCAP_VERSION_MINOR,
+        .snaplen = cap.snaplen,
+        .linktype = PCAP_LINKTYPE_ETHERNET
+    };
+    sigset_t all, old;
+
+    cap.fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (cap.fd == -1)
+        err(1, "Could not open capture file: %s", path);
+    if (write(cap.fd, &fh, sizeof fh) != sizeof fh)
+        err(1, "Could not write to capture file: %s", path);
+
+    cap.ring = malloc(CAPTURE_RING_SIZE);
+    if (cap.ring == NULL)
+        err(1, "malloc");
+    if (ring_pipe(cap.wakefd) == -1)
+        err(1, "Could not create capture pipe");
+
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+    if (pthread_create(&cap.thread, NULL, capture_thread_fn, NULL) != 0)
+        errx(1, "Could not create capture thread");
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    atexit(capture_fini);
+}
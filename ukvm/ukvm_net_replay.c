@@ -0,0 +1,223 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_net_replay.c: Packet capture replay backend
+ * (--net=replay:FILE.pcap[,loop]).
+ *
+ * Frames from a pcap file (Ethernet link type) are fed to the guest as fast
+ * as it reads them, optionally looping back to the start of the file once
+ * all have been read. Frames sent by the guest are counted and discarded.
+ * Statistics are printed when ukvm exits, giving a deterministic guest
+ * receive benchmark which needs no network or privileges.
+ *
+ * This file is included from ukvm_module_net.c.
+ */
+
+#include <sys/stat.h>
+#include <time.h>
+
+static struct {
+    const uint8_t *buf;
+    size_t size;
+    size_t off;
+    int swapped;
+    int loop;
+    /*
+     * Kept readable (holding one byte) for as long as there are frames left,
+     * so that UKVM_HYPERCALL_POLL and the ring I/O threads see the backend as
+     * having input.
+     */
+    int pipefd[2];
+    uint64_t rx_frames, rx_bytes, tx_frames, tx_bytes, loops;
+    struct timespec rx_start, rx_end;
+} rp;
+
+static uint32_t replay_u32(uint32_t v)
+{
+    return rp.swapped ? __builtin_bswap32(v) : v;
+}
+
+static void replay_stats(void)
+{
+    uint64_t nsecs;
+
+    nsecs = (rp.rx_end.tv_sec - rp.rx_start.tv_sec) * 1000000000ULL +
+        (rp.rx_end.tv_nsec - rp.rx_start.tv_nsec);
+    fprintf(stderr, "ukvm: net replay: guest received %" PRIu64 " frames "
+            "(%" PRIu64 " bytes, %" PRIu64 " loops) in %" PRIu64 " us, "
+            "%" PRIu64 " pps\n",
+            rp.rx_frames, rp.rx_bytes, rp.loops, nsecs / 1000,
+            nsecs ? (uint64_t)(rp.rx_frames * 1000000000ULL / nsecs) : 0);
+    fprintf(stderr, "ukvm: net replay: guest sent %" PRIu64 " frames "
+            "(%" PRIu64 " bytes)\n", rp.tx_frames, rp.tx_bytes);
+}
+
+static int replay_attach(const char *arg, int *fds,
+        unsigned nqueues __attribute__((unused)),
+        int offload __attribute__((unused)))
+{
+    const struct pcap_file_hdr *fh;
+    char *path, *opt;
+    struct stat st;
+    int fd = -1, saved_errno;
+
+    path = malloc(strlen(arg) + 1);
+    if (path == NULL)
+        return -1;
+    strcpy(path, arg);
+    opt = strchr(path, ',');
+    if (opt != NULL) {
+        *opt++ = '\0';
+        if (strcmp(opt, "loop") != 0) {
+            warnx("Invalid replay option: %s", opt);
+            errno = EINVAL;
+            goto out_error;
+        }
+        rp.loop = 1;
+    }
+
+    fd = open(path, O_RDONLY);
+    if (fd == -1)
+        goto out_error;
+    if (fstat(fd, &st) == -1)
+        goto out_error;
+    if (st.st_size < sizeof (struct pcap_file_hdr)) {
+        warnx("%s: Not a pcap file", path);
+        errno = EINVAL;
+        goto out_error;
+    }
+    rp.size = st.st_size;
+    rp.buf = mmap(NULL, rp.size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (rp.buf == MAP_FAILED) {
+        rp.buf = NULL;
+        goto out_error;
+    }
+    close(fd);
+    fd = -1;
+
+    fh = (const struct pcap_file_hdr *)rp.buf;
+    if (fh->magic == __builtin_bswap32(PCAP_MAGIC) ||
+        fh->magic == __builtin_bswap32(PCAP_MAGIC_NSEC))
+        rp.swapped = 1;
+    else if (fh->magic != PCAP_MAGIC && fh->magic != PCAP_MAGIC_NSEC) {
+        warnx("%s: Not a pcap file", path);
+        errno = EINVAL;
+        goto out_error;
+    }
+    if (replay_u32(fh->linktype) != PCAP_LINKTYPE_ETHERNET) {
+        warnx("%s: Unsupported link type %u", path, replay_u32(fh->linktype));
+        errno = EINVAL;
+        goto out_error;
+    }
+    rp.off = sizeof (struct pcap_file_hdr);
+    free(path);
+    path = NULL;
+
+    if (pipe(rp.pipefd) == -1)
+        goto out_error;
+    if (fcntl(rp.pipefd[0], F_SETFL, O_NONBLOCK) == -1)
+        goto out_pipe;
+    if (rp.size > rp.off) {
+        char c = 0;
+
+        if (write(rp.pipefd[1], &c, 1) != 1)
+            goto out_pipe;
+    }
+    atexit(replay_stats);
+
+    fds[0] = rp.pipefd[0];
+    return 0;
+
+out_pipe:
+    saved_errno = errno;
+    close(rp.pipefd[0]);
+    close(rp.pipefd[1]);
+    errno = saved_errno;
+out_error:
+    saved_errno = errno;
+    if (rp.buf != NULL) {
+        munmap((void *)rp.buf, rp.size);
+        rp.buf = NULL;
+    }
+    if (fd != -1)
+        close(fd);
+    free(path);
+    errno = saved_errno;
+    return -1;
+}
+
+static ssize_t replay_read(int fd, void *data, size_t len,
+        struct ukvm_net_hdr *hdr __attribute__((unused)))
+{
+    const struct pcap_rec_hdr *rh;
+    size_t incl_len;
+
+    do {
+        if (rp.off + sizeof (struct pcap_rec_hdr) > rp.size && rp.loop &&
+                rp.rx_frames > 0) {
+            rp.off = sizeof (struct pcap_file_hdr);
+            rp.loops++;
+        }
+        rh = (const struct pcap_rec_hdr *)(rp.buf + rp.off);
+        if (rp.off + sizeof (struct pcap_rec_hdr) > rp.size ||
+            rp.off + sizeof (struct pcap_rec_hdr) + replay_u32(rh->incl_len) >
+                rp.size) {
+            /*
+             * End of file (or a truncated record): no more input, ever.
+             */
+            char c;
+
+            while (read(fd, &c, 1) == 1)
+                ;
+            errno = EAGAIN;
+            return -1;
+        }
+        incl_len = replay_u32(rh->incl_len);
+        rp.off += sizeof (struct pcap_rec_hdr) + incl_len;
+    } while (incl_len == 0);
+
+    if (len > incl_len)
+        len = incl_len;
+    memcpy(data, rh + 1, len);
+
+    if (rp.rx_frames == 0)
+        clock_gettime(CLOCK_MONOTONIC, &rp.rx_start);
+    clock_gettime(CLOCK_MONOTONIC, &rp.rx_end);
+    rp.rx_frames++;
+    rp.rx_bytes += len;
+    return len;
+}
+
+static ssize_t replay_write(int fd __attribute__((unused)),
+        const void *data __attribute__((unused)), size_t len,
+        const struct ukvm_net_hdr *hdr __attribute__((unused)))
+{
+    rp.tx_frames++;
+    rp.tx_bytes += len;
+    return len;
+}
+
+static struct ukvm_net_backend ukvm_net_replay = {
+    .prefix = "replay:",
+    .attach = replay_attach,
+    .read = replay_read,
+    .write = replay_write
+};
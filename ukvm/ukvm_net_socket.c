@@ -0,0 +1,108 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_net_socket.c: Socket network backend (--net=socket:PATH).
+ *
+ * Each frame is carried as a single message on a connected AF_UNIX
+ * SOCK_SEQPACKET socket, e.g. to a user space switch or to another ukvm via a
+ * proxy, so no privileges are required. The syntax socket:@NN passes through
+ * an already connected datagram or seqpacket socket fd instead.
+ *
+ * This file is included from ukvm_module_net.c.
+ */
+
+#include <sys/socket.h>
+#include <sys/un.h>
+
+static int socket_attach(const char *path, int *fds,
+        unsigned nqueues __attribute__((unused)),
+        int offload __attribute__((unused)))
+{
+    struct sockaddr_un sun;
+    int fd, err;
+
+    if (path[0] == '@') {
+        fd = atoi(&path[1]);
+    }
+    else {
+        if (strlen(path) >= sizeof sun.sun_path) {
+            errno = ENAMETOOLONG;
+            return -1;
+        }
+        fd = socket(AF_UNIX, SOCK_SEQPACKET, 0);
+        if (fd == -1)
+            return -1;
+        memset(&sun, 0, sizeof sun);
+        sun.sun_family = AF_UNIX;
+        strcpy(sun.sun_path, path);
+        if (connect(fd, (struct sockaddr *)&sun, sizeof sun) == -1) {
+            err = errno;
+            close(fd);
+            errno = err;
+            return -1;
+        }
+    }
+    if (fcntl(fd, F_SETFL, O_NONBLOCK) == -1)
+        return -1;
+
+    fds[0] = fd;
+    return 0;
+}
+
+static ssize_t socket_read(int fd, void *data, size_t len,
+        struct ukvm_net_hdr *hdr __attribute__((unused)))
+{
+    return recv(fd, data, len, 0);
+}
+
+/*
+ * Frames are not dropped if the peer is slow to receive them; instead, wait
+ * until it has made space. If the peer has gone away, behave like a cable
+ * with nothing on the other end and silently drop the frame.
+ */
+static ssize_t socket_write(int fd, const void *data, size_t len,
+        const struct ukvm_net_hdr *hdr __attribute__((unused)))
+{
+    ssize_t ret;
+
+    for (;;) {
+        ret = send(fd, data, len, MSG_NOSIGNAL);
+        if (ret >= 0 || errno != EAGAIN)
+            break;
+
+        struct pollfd pfd = { .fd = fd, .events = POLLOUT };
+        if (poll(&pfd, 1, -1) == -1 && errno != EINTR)
+            err(1, "poll");
+    }
+    if (ret == -1 && (errno == EPIPE || errno == ECONNREFUSED ||
+                errno == ECONNRESET || errno == ENOTCONN)) {
+        UKVM_STATS_ADD(net.tx_drops, 1);
+        ret = len;
+    }
+    return ret;
+}
+
+static struct ukvm_net_backend ukvm_net_socket = {
+    .prefix = "socket:",
+    .attach = socket_attach,
+    .read = socket_read,
+    .write = socket_write
+};
@@ -0,0 +1,288 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_net_tap.c: TAP device network backend (--net=TAP).
+ *
+ * This file is included from ukvm_module_net.c.
+ */
+
+#include <ifaddrs.h>
+
+#if defined(__linux__)
+
+#include <sys/socket.h>
+#include <linux/if.h>
+#include <linux/if_tun.h>
+#include <linux/virtio_net.h>
+
+#elif defined(__FreeBSD__)
+
+#include <net/if.h>
+
+#else /* !__linux__ && !__FreeBSD__ */
+
+#error Unsupported target
+
+#endif
+
+/*
+ * If --net-offload is used, the TAP device carries a struct virtio_net_hdr
+ * (identical to struct ukvm_net_hdr) in front of every frame. (rx_offload) is
+ * set once the guest has asked for headers on received frames.
+ */
+static size_t vnet_hdr_len;
+static int rx_offload;
+
+/*
+ * Attach to an existing TAP interface named 'ifname'.
+ *
+ * Returns -1 and an appropriate errno on failure (ENOENT if the interface does
+ * not exist), and the tap device file descriptor on success.
+ */
+static int tap_attach(const char *ifname, int vnet_hdr, int multi_queue)
+{
+    int fd;
+
+    /*
+     * Syntax @<number> indicates a pre-existing open fd, so just pass it
+     * through without any checks.
+     */
+    if (ifname[0] == '@') {
+        /*
+         * We have no way of knowing whether the fd was opened with
+         * IFF_VNET_HDR.
+         */
+        if (vnet_hdr || multi_queue) {
+            errno = ENOTSUP;
+            return -1;
+        }
+        fd = atoi(&ifname[1]);
+
+        if (fcntl(fd, F_SETFL, O_NONBLOCK) == -1)
+            return -1;
+
+        return fd;
+    }
+
+    /*
+     * Verify that the interface exists and is up and running. If we don't do
+     * this then we get "create on open" behaviour on most systems which is not
+     * what we want.
+     */
+    struct ifaddrs *ifa, *ifp;
+    int found = 0;
+    int up = 0;
+
+    if (getifaddrs(&ifa) == -1)
+        return -1;
+    ifp = ifa;
+    while (ifp) {
+        if (strcmp(ifp->ifa_name, ifname) == 0) {
+            found = 1;
+            up = ifp->ifa_flags & (IFF_UP | IFF_RUNNING);
+            break;
+        }
+        ifp = ifp->ifa_next;
+    }
+    freeifaddrs(ifa);
+    if (!found) {
+        errno = ENOENT;
+        return -1;
+    }
+
+#if defined(__linux__)
+
+    if (!up) {
+        errno = ENETDOWN;
+        return -1;
+    }
+
+    int err;
+    struct ifreq ifr;
+
+    fd = open("/dev/net/tun", O_RDWR | O_NONBLOCK);
+    if (fd == -1)
+        return -1;
+
+    /*
+     * Initialise ifr for TAP interface.
+     */
+    memset(&ifr, 0, sizeof(ifr));
+    /*
+     * TODO: IFF_NO_PI may silently truncate packets on read().
+     */
+    ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
+    if (vnet_hdr)
+        ifr.ifr_flags |= IFF_VNET_HDR;
+    if (multi_queue)
+        ifr.ifr_flags |= IFF_MULTI_QUEUE;
+    if (strlen(ifname) > IFNAMSIZ) {
+        errno = EINVAL;
+        return -1;
+    }
+    strncpy(ifr.ifr_name, ifname, IFNAMSIZ);
+
+    /*
+     * Attach to the tap device; we have already verified that it exists, but
+     * see below.
+     */
+    if (ioctl(fd, TUNSETIFF, (void *)&ifr) == -1) {
+        err = errno;
+        close(fd);
+        errno = err;
+        return -1;
+    }
+    /*
+     * If we got back a different device than the one requested, e.g. because
+     * the caller mistakenly passed in '%d' (yes, that's really in the Linux
+     * API) then fail.
+     */
+    if (strncmp(ifr.ifr_name, ifname, IFNAMSIZ) != 0) {
+        close(fd);
+        errno = EINVAL;
+        return -1;
+    }
+    /*
+     * Offloads for frames received by the guest stay disabled until the guest
+     * asks for them (see tap_read()).
+     */
+    if (vnet_hdr && ioctl(fd, TUNSETOFFLOAD, 0) == -1) {
+        err = errno;
+        close(fd);
+        errno = err;
+        return -1;
+    }
+
+#elif defined(__FreeBSD__)
+
+    if (vnet_hdr || multi_queue) {
+        errno = ENOTSUP;
+        return -1;
+    }
+
+    char devname[strlen(ifname) + 6];
+
+    snprintf(devname, sizeof devname, "/dev/%s", ifname);
+    fd = open(devname, O_RDWR | O_NONBLOCK);
+    if (fd == -1)
+        return -1;
+
+#endif
+
+    return fd;
+}
+
+static int tap_attach_queues(const char *ifname, int *fds, unsigned nqueues,
+        int offload)
+{
+    if (offload) {
+        /*
+         * The host and guest both use the basic 10 byte header, which is
+         * also the TAP default.
+         */
+#if defined(__linux__)
+        assert(sizeof (struct ukvm_net_hdr) == sizeof (struct virtio_net_hdr));
+#endif
+        vnet_hdr_len = sizeof (struct ukvm_net_hdr);
+    }
+
+    for (unsigned i = 0; i < nqueues; i++) {
+        fds[i] = tap_attach(ifname, offload, nqueues > 1);
+        if (fds[i] < 0)
+            return -1;
+    }
+    return 0;
+}
+
+/*
+ * Write a single frame of (len) bytes to the TAP device, prepending the
+ * offload header (hdr) if the device expects one. (hdr) may be NULL, in which
+ * case the frame is sent without any offloads.
+ */
+static ssize_t tap_write(int fd, const void *data, size_t len,
+        const struct ukvm_net_hdr *hdr)
+{
+    static const struct ukvm_net_hdr nohdr;
+    struct iovec iov[2];
+    ssize_t ret;
+
+    if (vnet_hdr_len == 0)
+        return write(fd, data, len);
+
+    iov[0].iov_base = (void *)(hdr ? hdr : &nohdr);
+    iov[0].iov_len = vnet_hdr_len;
+    iov[1].iov_base = (void *)data;
+    iov[1].iov_len = len;
+    ret = writev(fd, iov, 2);
+    if (ret > 0)
+        ret -= vnet_hdr_len;
+    return ret;
+}
+
+/*
+ * Read a single frame of up to (len) bytes from the TAP device. If the device
+ * carries offload headers, the header is stored in (hdr), or discarded if
+ * (hdr) is NULL.
+ */
+static ssize_t tap_read(int fd, void *data, size_t len,
+        struct ukvm_net_hdr *hdr)
+{
+    struct ukvm_net_hdr tmp;
+    struct iovec iov[2];
+    ssize_t ret;
+
+    if (vnet_hdr_len == 0)
+        return read(fd, data, len);
+
+#if defined(__linux__)
+    /*
+     * The guest has asked for offload headers on received frames, so it can
+     * deal with partial checksums and large segments: tell the host kernel.
+     */
+    if (hdr != NULL && !rx_offload) {
+        unsigned offloads = TUN_F_CSUM | TUN_F_TSO4 | TUN_F_TSO6;
+
+        if (ioctl(fd, TUNSETOFFLOAD, offloads) == -1)
+            err(1, "Could not enable receive offloads");
+        rx_offload = 1;
+    }
+#endif
+
+    iov[0].iov_base = hdr ? hdr : &tmp;
+    iov[0].iov_len = vnet_hdr_len;
+    iov[1].iov_base = data;
+    iov[1].iov_len = len;
+    ret = readv(fd, iov, 2);
+    if (ret == -1 || ret == 0)
+        return ret;
+    assert(ret >= vnet_hdr_len);
+    return ret - vnet_hdr_len;
+}
+
+static struct ukvm_net_backend ukvm_net_tap = {
+    .prefix = NULL,
+#if defined(__linux__)
+    .flags = UKVM_NET_BACKEND_F_OFFLOAD | UKVM_NET_BACKEND_F_MULTIQUEUE,
+#endif
+    .attach = tap_attach_queues,
+    .read = tap_read,
+    .write = tap_write
+};
@@ -0,0 +1,298 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_profile.c: Guest sampling profiler (--profile).
+ *
+ * A profiling timer (ITIMER_PROF) delivers SIGPROF to the VCPU thread at the
+ * requested rate, which kicks the VCPU out of the guest. The guest stack is
+ * then unwound by following the frame pointer chain in guest memory, and
+ * identical stacks are aggregated. At exit, the stacks are symbolized using
+ * the guest ELF symbol table and written in the "folded" format used by
+ * flamegraph tools, one line per stack: "outer;...;inner count".
+ *
+ * Unwinding relies on the guest being built with frame pointers; for code
+ * built without them, stacks are truncated.
+ */
+
+#define _GNU_SOURCE
+#include <assert.h>
+#include <err.h>
+#include <errno.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "ukvm.h"
+
+#define PROFILE_DEPTH   64      /* Max. frames recorded per sample */
+#define PROFILE_STACKS  8192    /* Max. distinct stacks, power of 2 */
+
+struct stack {
+    uint64_t count;
+    unsigned depth;
+    uint64_t pc[PROFILE_DEPTH]; /* Innermost first */
+};
+
+volatile int ukvm_profile_pending = 0;
+
+static struct ukvm_hv *profile_hv;
+static const char *profile_file;
+static struct stack *stacks;
+static uint64_t samples, lost;
+static struct ukvm_elf_sym *syms;
+static size_t nsyms;
+
+static void profile_handler(int signo __attribute__((unused)))
+{
+    ukvm_profile_pending = 1;
+    ukvm_hv_vcpu_kick(profile_hv);
+}
+
+/*
+ * Read the 8-byte value at guest address (gpa) into (*v), without aborting
+ * on invalid addresses. Guest virtual and physical addresses are identical.
+ */
+static int guest_read64(struct ukvm_hv *hv, uint64_t gpa, uint64_t *v)
+{
+    if (gpa & 7 || gpa >= hv->mem_size || hv->mem_size - gpa < 8)
+        return -1;
+    memcpy(v, hv->mem + gpa, 8);
+    return 0;
+}
+
+/*
+ * Returns 1 if (addr) could be a code address. Without symbols, anything
+ * non-zero is accepted.
+ */
+static int text_address(uint64_t addr)
+{
+    if (nsyms == 0)
+        return addr != 0;
+    return addr >= syms[0].addr &&
+        addr < syms[nsyms - 1].addr + syms[nsyms - 1].size;
+}
+
+static uint64_t stack_hash(const uint64_t *pc, unsigned depth)
+{
+    uint64_t h = 14695981039346656037ULL;
+
+    for (unsigned i = 0; i < depth; i++) {
+        h ^= pc[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+void ukvm_profile_sample(struct ukvm_hv *hv)
+{
+    uint64_t pc[PROFILE_DEPTH], fp;
+    unsigned depth = 0;
+
+    ukvm_profile_pending = 0;
+    if (ukvm_hv_vcpu_sample(hv, &pc[0], &fp) == -1) {
+        lost++;
+        return;
+    }
+    depth = 1;
+
+    /*
+     * Each frame holds the caller's frame pointer at (fp) and the return
+     * address at (fp + 8). Frames must be at increasing addresses, which
+     * also guarantees termination.
+     */
+    while (depth < PROFILE_DEPTH && fp != 0) {
+        uint64_t next, ret;
+
+        if (guest_read64(hv, fp, &next) == -1 ||
+                guest_read64(hv, fp + 8, &ret) == -1 || !text_address(ret))
+            break;
+        pc[depth++] = ret;
+        if (next <= fp)
+            break;
+        fp = next;
+    }
+
+    uint64_t h = stack_hash(pc, depth);
+    for (unsigned i = 0; i < PROFILE_STACKS; i++) {
+        struct stack *s = &stacks[(h + i) & (PROFILE_STACKS - 1)];
+
+        if (s->count == 0) {
+            s->depth = depth;
+            memcpy(s->pc, pc, depth * sizeof pc[0]);
+        }
+        else if (s->depth != depth ||
+                memcmp(s->pc, pc, depth * sizeof pc[0]) != 0)
+            continue;
+        s->count++;
+        samples++;
+        return;
+    }
+    lost++;
+}
+
+/*
+ * Append the name of the symbol containing (addr), or (addr) if there is
+ * none, to (f).
+ */
+static void print_symbol(FILE *f, uint64_t addr)
+{
+    size_t lo = 0, hi = nsyms;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (syms[mid].addr <= addr)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo > 0 && (syms[lo - 1].size == 0 ||
+                addr < syms[lo - 1].addr + syms[lo - 1].size))
+        fputs(syms[lo - 1].name, f);
+    else
+        fprintf(f, "0x%" PRIx64, addr);
+}
+
+struct folded {
+    char *str;
+    uint64_t count;
+};
+
+static int folded_compare(const void *a, const void *b)
+{
+    return strcmp(((const struct folded *)a)->str,
+            ((const struct folded *)b)->str);
+}
+
+static void profile_fini(void)
+{
+    struct itimerval it;
+    struct folded *out;
+    size_t nout = 0;
+    FILE *f;
+
+    memset(&it, 0, sizeof it);
+    setitimer(ITIMER_PROF, &it, NULL);
+
+    /*
+     * Symbolize each stack. Stacks which differ only in addresses within the
+     * same functions produce the same string, and are merged below.
+     */
+    out = calloc(PROFILE_STACKS, sizeof *out);
+    if (out == NULL) {
+        warn("profile: calloc");
+        return;
+    }
+    for (unsigned i = 0; i < PROFILE_STACKS; i++) {
+        struct stack *s = &stacks[i];
+        size_t len;
+        FILE *m;
+
+        if (s->count == 0)
+            continue;
+        m = open_memstream(&out[nout].str, &len);
+        if (m == NULL)
+            continue;
+        /*
+         * Return addresses point after the call instruction, which may be
+         * the first byte of the next function, so symbolize (ret - 1).
+         */
+        for (unsigned d = s->depth; d-- > 0; ) {
+            print_symbol(m, d ? s->pc[d] - 1 : s->pc[d]);
+            if (d)
+                fputc(';', m);
+        }
+        fclose(m);
+        out[nout++].count = s->count;
+    }
+    qsort(out, nout, sizeof *out, folded_compare);
+
+    f = fopen(profile_file, "w");
+    if (f == NULL) {
+        warn("Could not open profile file: %s", profile_file);
+        return;
+    }
+    for (size_t i = 0; i < nout; i++) {
+        uint64_t count = out[i].count;
+
+        while (i + 1 < nout && !strcmp(out[i].str, out[i + 1].str))
+            count += out[++i].count;
+        fprintf(f, "%s %" PRIu64 "\n", out[i].str, count);
+    }
+    if (fclose(f) != 0)
+        warn("Could not write profile file: %s", profile_file);
+    if (lost)
+        warnx("profile: %" PRIu64 " samples, %" PRIu64 " lost", samples,
+                lost);
+}
+
+/*
+ * (arg) is of the form FILE[,HZ].
+ */
+void ukvm_profile_init(struct ukvm_hv *hv, const char *arg)
+{
+    unsigned long hz = 99;
+    struct sigaction sa;
+    struct itimerval it;
+    uint64_t pc, fp;
+    char *file, *comma;
+
+    file = strdup(arg);
+    if (file == NULL)
+        err(1, "strdup");
+    comma = strrchr(file, ',');
+    if (comma != NULL) {
+        char *end;
+
+        *comma = '\0';
+        hz = strtoul(comma + 1, &end, 10);
+        if (*end != '\0' || hz < 1 || hz > 10000)
+            errx(1, "Invalid profiling frequency: %s (must be 1..10000)",
+                    comma + 1);
+    }
+    profile_file = file;
+    profile_hv = hv;
+
+    if (ukvm_hv_vcpu_sample(hv, &pc, &fp) == -1)
+        errx(1, "Profiling is not supported by this backend");
+    if (ukvm_elf_load_symbols(&syms, &nsyms) == -1)
+        warnx("profile: No guest symbols, reporting addresses only");
+    stacks = calloc(PROFILE_STACKS, sizeof (struct stack));
+    if (stacks == NULL)
+        err(1, "calloc");
+    atexit(profile_fini);
+
+    memset(&sa, 0, sizeof sa);
+    sa.sa_handler = profile_handler;
+    sa.sa_flags = SA_RESTART;
+    sigfillset(&sa.sa_mask);
+    if (sigaction(SIGPROF, &sa, NULL) == -1)
+        err(1, "Could not install signal handler");
+
+    it.it_interval.tv_sec = (1000000 / hz) / 1000000;
+    it.it_interval.tv_usec = (1000000 / hz) % 1000000;
+    it.it_value = it.it_interval;
+    if (setitimer(ITIMER_PROF, &it, NULL) == -1)
+        err(1, "setitimer");
+}
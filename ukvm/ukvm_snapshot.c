@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_snapshot.c: Guest snapshots (--snapshot, --restore).
+ *
+ * A snapshot is taken when the guest makes UKVM_HYPERCALL_SNAPSHOT, just
+ * before it calls solo5_app_main(). It consists of a header, the VCPU state
+ * as returned by ukvm_hv_vcpu_save(), and guest memory at (mem_offset). Pages
+ * of guest memory which are all zeroes are left as holes in the file.
+ *
+ * A restored instance maps guest memory copy-on-write (MAP_PRIVATE) from the
+ * snapshot, so that it is paged in on demand and unmodified pages are shared
+ * between instances through the host page cache.
+ *
+ * Only the guest is saved: modules are set up again from the command line of
+ * the restored instance. This is only safe because the guest does not use any
+ * devices before solo5_app_main().
+ */
+
+#define _GNU_SOURCE
+#include <assert.h>
+#include <err.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ukvm.h"
+
+#define SNAPSHOT_MAGIC      "UKVMSNAP"
+#define SNAPSHOT_VERSION    1
+#define SNAPSHOT_ALIGN      (2 * 1024 * 1024)
+#define SNAPSHOT_PAGE       4096
+
+struct snapshot_hdr {
+    char magic[8];
+    uint32_t version;
+    uint32_t state_len;         /* VCPU state, follows the header */
+    uint64_t mem_size;
+    uint64_t mem_offset;        /* Guest memory, SNAPSHOT_ALIGN aligned */
+    uint64_t nsecs;             /* CLOCK_REALTIME when taken */
+};
+
+static const char *snapshot_path;
+static int restore_fd = -1;
+static struct snapshot_hdr restore_hdr;
+
+static uint64_t realtime_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (ts.tv_sec * 1000000000ULL) + ts.tv_nsec;
+}
+
+void ukvm_snapshot_init(const char *path)
+{
+    snapshot_path = path;
+}
+
+static int page_is_zero(const uint8_t *p)
+{
+    const uint64_t *w = (const uint64_t *)p;
+    size_t i;
+
+    for (i = 0; i < SNAPSHOT_PAGE / sizeof *w; i++) {
+        if (w[i])
+            return 0;
+    }
+    return 1;
+}
+
+/*
+ * Release guest memory which has been saved. MADV_REMOVE frees the pages of
+ * shared memory (the default for guest memory) and hugetlbfs, MADV_DONTNEED
+ * those of private mappings.
+ */
+static void release_mem(uint8_t *p, size_t len)
+{
+#ifdef MADV_REMOVE
+    if (madvise(p, len, MADV_REMOVE) == 0)
+        return;
+#endif
+    (void)madvise(p, len, MADV_DONTNEED);
+}
+
+/*
+ * Write the non-zero pages of guest memory to (fd) at (offset).
+ *
+ * Every page is read, as one which is not resident (e.g. swapped out) may
+ * still hold data. Reading a page the guest never touched allocates it, so
+ * guest memory is released a chunk at a time once it has been saved; the
+ * monitor exits as soon as the snapshot is written.
+ */
+static void save_mem(struct ukvm_hv *hv, int fd, off_t offset)
+{
+    size_t chunk, i, start, end;
+
+    for (chunk = 0; chunk < hv->mem_size; chunk += SNAPSHOT_ALIGN) {
+        end = chunk + SNAPSHOT_ALIGN;
+        if (end > hv->mem_size)
+            end = hv->mem_size;
+        for (i = chunk; i < end; ) {
+            if (page_is_zero(hv->mem + i)) {
+                i += SNAPSHOT_PAGE;
+                continue;
+            }
+            for (start = i; i < end && !page_is_zero(hv->mem + i);
+                    i += SNAPSHOT_PAGE)
+                ;
+            if (pwrite(fd, hv->mem + start, i - start, offset + start) !=
+                    (ssize_t)(i - start))
+                err(1, "%s: Could not write snapshot", snapshot_path);
+        }
+        release_mem(hv->mem + chunk, end - chunk);
+    }
+}
+
+static void snapshot_save(struct ukvm_hv *hv)
+{
+    struct snapshot_hdr hdr;
+    void *state;
+    size_t len;
+    int fd;
+
+    if (ukvm_hv_vcpu_save(hv, &state, &len) == -1)
+        errx(1, "Snapshots are not supported on this host");
+
+    memset(&hdr, 0, sizeof hdr);
+    memcpy(hdr.magic, SNAPSHOT_MAGIC, sizeof hdr.magic);
+    hdr.version = SNAPSHOT_VERSION;
+    hdr.state_len = len;
+    hdr.mem_size = hv->mem_size;
+    hdr.mem_offset = (sizeof hdr + len + SNAPSHOT_ALIGN - 1) &
+        ~(uint64_t)(SNAPSHOT_ALIGN - 1);
+    hdr.nsecs = realtime_now();
+
+    fd = open(snapshot_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1)
+        err(1, "Could not open snapshot: %s", snapshot_path);
+    if (ftruncate(fd, hdr.mem_offset + hdr.mem_size) == -1 ||
+            pwrite(fd, &hdr, sizeof hdr, 0) != sizeof hdr ||
+            pwrite(fd, state, len, sizeof hdr) != (ssize_t)len)
+        err(1, "%s: Could not write snapshot", snapshot_path);
+    save_mem(hv, fd, hdr.mem_offset);
+    if (close(fd) == -1)
+        err(1, "%s: Could not write snapshot", snapshot_path);
+}
+
+void ukvm_snapshot_hypercall(struct ukvm_hv *hv, ukvm_gpa_t gpa)
+{
+    struct ukvm_snapshot *s =
+        UKVM_CHECKED_GPA_P(hv, gpa, sizeof (struct ukvm_snapshot));
+
+    if (snapshot_path == NULL) {
+        s->ret = 0;
+        return;
+    }
+
+    /*
+     * Instances restored from the snapshot see (ret) as 1.
+     */
+    s->ret = 1;
+    snapshot_save(hv);
+    exit(0);
+}
+
+size_t ukvm_snapshot_open(const char *path)
+{
+    struct snapshot_hdr *h = &restore_hdr;
+    struct stat st;
+
+    restore_fd = open(path, O_RDONLY);
+    if (restore_fd == -1)
+        err(1, "Could not open snapshot: %s", path);
+    if (pread(restore_fd, h, sizeof *h, 0) != sizeof *h ||
+            memcmp(h->magic, SNAPSHOT_MAGIC, sizeof h->magic) != 0)
+        errx(1, "%s: Not a ukvm snapshot", path);
+    if (h->version != SNAPSHOT_VERSION)
+        errx(1, "%s: Unsupported snapshot version %u", path, h->version);
+    if (fstat(restore_fd, &st) == -1)
+        err(1, "%s: fstat() failed", path);
+    if (h->mem_offset & (SNAPSHOT_ALIGN - 1) ||
+            h->mem_offset < sizeof *h + h->state_len ||
+            (uint64_t)st.st_size < h->mem_offset + h->mem_size)
+        errx(1, "%s: Snapshot is truncated or corrupt", path);
+    return h->mem_size;
+}
+
+void ukvm_snapshot_move_fd(int min)
+{
+    int fd;
+
+    if (restore_fd == -1)
+        return;
+    fd = fcntl(restore_fd, F_DUPFD, min);
+    if (fd == -1)
+        err(1, "fcntl(F_DUPFD) failed");
+    close(restore_fd);
+    restore_fd = fd;
+}
+
+void ukvm_snapshot_restore(struct ukvm_hv *hv)
+{
+    struct snapshot_hdr *h = &restore_hdr;
+    uint64_t now = realtime_now();
+    void *state, *mem;
+    int flags;
+
+    assert(restore_fd != -1);
+    if (hv->mem_size != h->mem_size)
+        errx(1, "Snapshot memory size %" PRIu64 " is not supported",
+                h->mem_size);
+
+    /*
+     * Replace guest memory with a private mapping of the snapshot. This must
+     * be done before the guest first runs, while KVM has no mappings of the
+     * old pages.
+     */
+    flags = MAP_PRIVATE | MAP_FIXED;
+#ifdef MAP_NORESERVE
+    /*
+     * As for guest memory itself, only pages the guest writes to need
+     * backing.
+     */
+    flags |= MAP_NORESERVE;
+#endif
+    mem = mmap(hv->mem, hv->mem_size, PROT_READ | PROT_WRITE, flags,
+            restore_fd, h->mem_offset);
+    if (mem == MAP_FAILED)
+        err(1, "Could not map snapshot");
+    assert(mem == hv->mem);
+
+    state = malloc(h->state_len);
+    if (state == NULL)
+        err(1, "malloc");
+    if (pread(restore_fd, state, h->state_len, sizeof *h) !=
+            (ssize_t)h->state_len)
+        err(1, "Could not read snapshot");
+    if (ukvm_hv_vcpu_restore(hv, state, h->state_len,
+                now > h->nsecs ? now - h->nsecs : 0) == -1)
+        errx(1, "Snapshot cannot be restored on this host");
+    free(state);
+    close(restore_fd);
+    restore_fd = -1;
+}
@@ -0,0 +1,94 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_stats.h: Layout of the shared-memory statistics segment (--stats).
+ *
+ * This header is shared between the monitor and ukvm-top, and must be kept
+ * self-contained with no external dependencies other than C99 headers.
+ */
+
+#ifndef UKVM_STATS_H
+#define UKVM_STATS_H
+
+#include <stdint.h>
+
+#define UKVM_STATS_MAGIC        0x53544154534d564bULL   /* "KVMSTATS" */
+#define UKVM_STATS_VERSION      4
+
+/*
+ * Sizes of the per-exit-reason, per-hypercall and per-disk arrays. These are
+ * fixed so that the layout does not change when hypercalls are added.
+ */
+#define UKVM_STATS_EXITS        64
+#define UKVM_STATS_HYPERCALLS   64
+#define UKVM_STATS_DISKS        8       /* UKVM_BLK_MAX */
+
+/*
+ * All counters are monotonically increasing, and all times are in
+ * nanoseconds. Counters are updated in place with no further
+ * synchronisation, so a reader may see a counter which is behind another by
+ * one event. (hv) names the hypervisor backend, which defines the meaning of
+ * an index into (exits).
+ */
+struct ukvm_stats {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t pid;
+    char hv[16];
+    uint64_t start_nsecs;                   /* CLOCK_MONOTONIC */
+
+    uint64_t exits[UKVM_STATS_EXITS];
+    uint64_t hypercalls[UKVM_STATS_HYPERCALLS];
+    uint64_t hypercall_nsecs[UKVM_STATS_HYPERCALLS];
+
+    /*
+     * Time spent in the hypervisor running the guest, in hypercall handlers
+     * (total of hypercall_nsecs[]), and of that, blocked in
+     * UKVM_HYPERCALL_POLL.
+     */
+    uint64_t run_nsecs;
+    uint64_t hypercall_total_nsecs;
+    uint64_t poll_nsecs;
+
+    struct {
+        uint64_t rx_packets, rx_bytes;
+        uint64_t tx_packets, tx_bytes;
+        uint64_t rx_drops, tx_drops;
+    } net;
+
+    /*
+     * Per block device, in the order given on the command line; (ndisks)
+     * entries are used. With --disk-direct, (direct) and (bounced) count
+     * requests done directly on guest memory and those copied through a
+     * bounce buffer because they were not aligned.
+     */
+    uint32_t ndisks;
+    uint32_t reserved;
+    struct {
+        char name[16];                      /* Empty for an unnamed disk */
+        uint64_t reads, read_bytes;
+        uint64_t writes, write_bytes;
+        uint64_t direct, bounced;
+        uint64_t flushes;
+    } blk[UKVM_STATS_DISKS];
+};
+
+#endif /* UKVM_STATS_H */
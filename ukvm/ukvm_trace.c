@@ -0,0 +1,208 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_trace.c: Hypercall tracing (--trace).
+ *
+ * The VCPU thread appends a record for each hypercall to a single-producer,
+ * single-consumer ring. A tracing thread writes the ring out to the trace
+ * file in large chunks, so the VCPU never waits for I/O; if the ring is
+ * full, the record is dropped and counted.
+ */
+
+#define _GNU_SOURCE
+#include <assert.h>
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "ukvm.h"
+#include "ukvm_trace.h"
+
+#define TRACE_RING_RECS     65536   /* 1MB */
+#define TRACE_WAKE_RECS     (TRACE_RING_RECS / 2)
+
+int ukvm_trace_enabled = 0;
+
+static struct {
+    int fd;
+    struct ukvm_trace_rec *ring;
+    uint64_t head, tail;            /* Free-running record counts */
+    uint64_t records, drops;
+    int wakefd[2];
+    int stop;
+    pthread_t thread;
+    /*
+     * Cycle counter and CLOCK_MONOTONIC at start of tracing, used to compute
+     * the cycle counter frequency when the trace is closed.
+     */
+    uint64_t cycles0, nsecs0;
+} tr = { .fd = -1 };
+
+void ukvm_trace_hypercall(int nr, uint64_t enter, uint64_t exit)
+{
+    uint64_t head = tr.head;
+    uint64_t tail = __atomic_load_n(&tr.tail, __ATOMIC_ACQUIRE);
+
+    if (head - tail == TRACE_RING_RECS) {
+        tr.drops++;
+        return;
+    }
+    tr.ring[head % TRACE_RING_RECS].enter = enter;
+    tr.ring[head % TRACE_RING_RECS].info = ((exit - enter) << 8) | nr;
+    __atomic_store_n(&tr.head, head + 1, __ATOMIC_RELEASE);
+    tr.records++;
+    if (head - tail == TRACE_WAKE_RECS) {
+        char c = 0;
+
+        if (write(tr.wakefd[1], &c, 1) == -1)
+            assert(errno == EAGAIN);
+    }
+}
+
+/*
+ * Write out all records up to the current head. Returns -1 on error.
+ */
+static int trace_flush(void)
+{
+    uint64_t head = __atomic_load_n(&tr.head, __ATOMIC_ACQUIRE);
+    uint64_t tail = tr.tail;
+
+    while (tail != head) {
+        size_t off = tail % TRACE_RING_RECS;
+        size_t n = TRACE_RING_RECS - off;
+        ssize_t ret;
+
+        if (n > head - tail)
+            n = head - tail;
+        ret = write(tr.fd, &tr.ring[off], n * sizeof (struct ukvm_trace_rec));
+        if (ret == -1 && errno == EINTR)
+            continue;
+        if (ret <= 0 || ret % sizeof (struct ukvm_trace_rec))
+            return -1;
+        tail += ret / sizeof (struct ukvm_trace_rec);
+        __atomic_store_n(&tr.tail, tail, __ATOMIC_RELEASE);
+    }
+    return 0;
+}
+
+static void *trace_thread_fn(void *arg __attribute__((unused)))
+{
+    struct pollfd pfd = { .fd = tr.wakefd[0], .events = POLLIN };
+    char buf[64];
+
+    while (!__atomic_load_n(&tr.stop, __ATOMIC_ACQUIRE)) {
+        if (poll(&pfd, 1, 100) == -1 && errno != EINTR)
+            break;
+        while (read(tr.wakefd[0], buf, sizeof buf) > 0)
+            ;
+        if (trace_flush() == -1)
+            goto out_err;
+    }
+    if (trace_flush() == -1)
+        goto out_err;
+    return NULL;
+
+out_err:
+    warn("Could not write to trace file");
+    return NULL;
+}
+
+static uint64_t trace_nsecs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000000ULL) + ts.tv_nsec;
+}
+
+static void trace_fini(void)
+{
+    struct ukvm_trace_hdr hdr;
+    uint64_t cycles, nsecs;
+
+    ukvm_trace_enabled = 0;
+    cycles = ukvm_trace_cycles();
+    nsecs = trace_nsecs();
+    __atomic_store_n(&tr.stop, 1, __ATOMIC_RELEASE);
+    if (write(tr.wakefd[1], "", 1) == -1)
+        assert(errno == EAGAIN);
+    pthread_join(tr.thread, NULL);
+
+    memset(&hdr, 0, sizeof hdr);
+    hdr.magic = UKVM_TRACE_MAGIC;
+    hdr.version = UKVM_TRACE_VERSION;
+    hdr.rec_size = sizeof (struct ukvm_trace_rec);
+    if (nsecs > tr.nsecs0)
+        hdr.cycles_per_sec = (uint64_t)((cycles - tr.cycles0) * 1e9 /
+                (nsecs - tr.nsecs0));
+    hdr.records = tr.records;
+    hdr.drops = tr.drops;
+    if (pwrite(tr.fd, &hdr, sizeof hdr, 0) != sizeof hdr)
+        warn("Could not write to trace file");
+    close(tr.fd);
+    if (tr.drops)
+        warnx("trace: %" PRIu64 " records, %" PRIu64 " dropped",
+                tr.records, tr.drops);
+}
+
+void ukvm_trace_init(const char *path)
+{
+    struct ukvm_trace_hdr hdr;
+    sigset_t all, old;
+
+    tr.fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (tr.fd == -1)
+        err(1, "Could not open trace file: %s", path);
+    memset(&hdr, 0, sizeof hdr);
+    hdr.magic = UKVM_TRACE_MAGIC;
+    hdr.version = UKVM_TRACE_VERSION;
+    hdr.rec_size = sizeof (struct ukvm_trace_rec);
+    if (write(tr.fd, &hdr, sizeof hdr) != sizeof hdr)
+        err(1, "Could not write to trace file: %s", path);
+
+    tr.ring = malloc(TRACE_RING_RECS * sizeof (struct ukvm_trace_rec));
+    if (tr.ring == NULL)
+        err(1, "malloc");
+    if (pipe(tr.wakefd) == -1 ||
+            fcntl(tr.wakefd[0], F_SETFL, O_NONBLOCK) == -1 ||
+            fcntl(tr.wakefd[1], F_SETFL, O_NONBLOCK) == -1)
+        err(1, "Could not create trace pipe");
+
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+    if (pthread_create(&tr.thread, NULL, trace_thread_fn, NULL) != 0)
+        errx(1, "Could not create trace thread");
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+    tr.cycles0 = ukvm_trace_cycles();
+    tr.nsecs0 = trace_nsecs();
+    atexit(trace_fini);
+    ukvm_trace_enabled = 1;
+}
@@ -0,0 +1,64 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_trace.h: Format of hypercall trace files (--trace).
+ *
+ * This header is shared between the monitor and ukvm-trace, and must be kept
+ * self-contained with no external dependencies other than C99 headers.
+ */
+
+#ifndef UKVM_TRACE_H
+#define UKVM_TRACE_H
+
+#include <stdint.h>
+
+#define UKVM_TRACE_MAGIC        0x314352544d564b55ULL   /* "UKVMTRC1" */
+#define UKVM_TRACE_VERSION      1
+
+/*
+ * A trace file consists of a header followed by records in the order the
+ * hypercalls were made. The header is rewritten when the trace is closed;
+ * a (cycles_per_sec) of 0 means the trace was not closed cleanly.
+ */
+struct ukvm_trace_hdr {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t rec_size;                  /* sizeof (struct ukvm_trace_rec) */
+    uint64_t cycles_per_sec;            /* Cycle counter frequency */
+    uint64_t records;
+    uint64_t drops;                     /* Records lost, ring full */
+};
+
+/*
+ * One record per hypercall. (enter) is the value of the host cycle counter
+ * when the handler was entered. (info) holds the hypercall number in its low
+ * 8 bits and the number of cycles spent in the handler in the remaining 56.
+ */
+struct ukvm_trace_rec {
+    uint64_t enter;
+    uint64_t info;
+};
+
+#define UKVM_TRACE_REC_NR(r)        ((unsigned)((r)->info & 0xff))
+#define UKVM_TRACE_REC_CYCLES(r)    ((r)->info >> 8)
+#define UKVM_TRACE_REC_EXIT(r)      ((r)->enter + UKVM_TRACE_REC_CYCLES(r))
+
+#endif /* UKVM_TRACE_H */
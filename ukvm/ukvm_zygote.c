@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_zygote.c: Zygote mode (--zygote).
+ *
+ * The zygote loads the unikernel once into a guest image backed by an
+ * anonymous shared memory file, and then forks a new instance for each launch
+ * request received on its socket (see ukvm_zygote.h). Each instance creates
+ * its own VM, and maps the image into it copy-on-write, so that the cost of
+ * starting ukvm and of loading the ELF is only paid once. With --restore,
+ * instances are restored from the snapshot instead, which also saves the cost
+ * of booting the guest.
+ *
+ * The zygote itself is single-threaded and never creates a VM, as neither
+ * threads nor KVM file descriptors survive fork().
+ */
+
+#define _GNU_SOURCE
+#include <assert.h>
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "ukvm.h"
+#include "ukvm_zygote.h"
+
+static int image_fd = -1;
+static size_t image_size;
+
+static int image_create(size_t size)
+{
+    int fd;
+
+    /*
+     * Mapping the image over guest memory relies on KVM using whatever is
+     * mapped at the guest memory address, so this is only supported on Linux.
+     */
+#if defined(__linux__)
+    fd = memfd_create("ukvm-zygote", MFD_CLOEXEC);
+#else
+    fd = -1;
+    errno = ENOTSUP;
+#endif
+    if (fd == -1)
+        err(1, "Zygote: Could not create guest image");
+    if (ftruncate(fd, size) == -1)
+        err(1, "Zygote: Could not size guest image");
+    return fd;
+}
+
+static int listen_on(const char *path)
+{
+    struct sockaddr_un sun;
+    int fd;
+
+    if (strlen(path) >= sizeof sun.sun_path)
+        errx(1, "Zygote: Socket path too long: %s", path);
+    memset(&sun, 0, sizeof sun);
+    sun.sun_family = AF_UNIX;
+    strcpy(sun.sun_path, path);
+
+    fd = socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (fd == -1)
+        err(1, "Zygote: socket() failed");
+    (void)unlink(path);
+    if (bind(fd, (struct sockaddr *)&sun, sizeof sun) == -1)
+        err(1, "Zygote: Could not bind to %s", path);
+    if (listen(fd, SOMAXCONN) == -1)
+        err(1, "Zygote: listen() failed");
+    return fd;
+}
+
+/*
+ * Move (fd) to the lowest free descriptor >= (min).
+ */
+static int fd_above(int fd, int min)
+{
+    int nfd = fcntl(fd, F_DUPFD, min);
+
+    if (nfd == -1)
+        err(1, "Zygote: fcntl(F_DUPFD) failed");
+    close(fd);
+    return nfd;
+}
+
+/*
+ * Receive a request on (conn). Returns the number of strings in (buf) and the
+ * descriptors in (fds, *nfds), or -1 if the request is malformed.
+ */
+static int recv_request(int conn, char *buf, int *fds, int *nfds)
+{
+    union {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(UKVM_ZYGOTE_FDS_MAX * sizeof (int))];
+    } cmsg;
+    struct iovec iov = { .iov_base = buf, .iov_len = UKVM_ZYGOTE_REQ_MAX };
+    struct msghdr msg = {
+        .msg_iov = &iov, .msg_iovlen = 1,
+        .msg_control = cmsg.buf, .msg_controllen = sizeof cmsg.buf
+    };
+    struct cmsghdr *c;
+    ssize_t len, i;
+    int n = 0;
+
+    *nfds = 0;
+    len = recvmsg(conn, &msg, MSG_CMSG_CLOEXEC);
+    if (len == -1)
+        return -1;
+    for (c = CMSG_FIRSTHDR(&msg); c; c = CMSG_NXTHDR(&msg, c)) {
+        if (c->cmsg_level == SOL_SOCKET && c->cmsg_type == SCM_RIGHTS) {
+            *nfds = (c->cmsg_len - CMSG_LEN(0)) / sizeof (int);
+            memcpy(fds, CMSG_DATA(c), *nfds * sizeof (int));
+        }
+    }
+    if (msg.msg_flags & (MSG_TRUNC | MSG_CTRUNC))
+        return -1;
+    if (len > 0 && buf[len - 1] != 0)
+        return -1;
+    for (i = 0; i < len; i++)
+        n += (buf[i] == 0);
+    return n;
+}
+
+/*
+ * Set up the descriptors of a new instance: (fds) become 0 ... (nfds - 1),
+ * and (conn) is kept open above them until the instance exits.
+ */
+static void setup_instance_fds(int listenfd, int conn, int *fds, int nfds)
+{
+    int i;
+
+    close(listenfd);
+    conn = fd_above(conn, nfds);
+    if (image_fd != -1)
+        image_fd = fd_above(image_fd, nfds);
+    ukvm_snapshot_move_fd(nfds);
+    for (i = 0; i < nfds; i++)
+        fds[i] = fd_above(fds[i], nfds);
+    for (i = 0; i < nfds; i++) {
+        if (dup2(fds[i], i) == -1)
+            err(1, "Zygote: dup2() failed");
+        close(fds[i]);
+    }
+    if (fcntl(conn, F_SETFD, FD_CLOEXEC) == -1)
+        err(1, "Zygote: fcntl(F_SETFD) failed");
+}
+
+void ukvm_zygote_serve(const char *path, const char *elffile, size_t mem_size,
+        int *argc, char ***argv, ukvm_gpa_t *gpa_ep, ukvm_gpa_t *gpa_kend)
+{
+    static char buf[UKVM_ZYGOTE_REQ_MAX];
+    int fds[UKVM_ZYGOTE_FDS_MAX], nfds, listenfd, conn, n, i;
+    struct ukvm_zygote_reply reply;
+    struct timeval tv = { .tv_sec = UKVM_ZYGOTE_REQ_TIMEOUT };
+    uint8_t *mem;
+    pid_t pid;
+
+    /*
+     * Without (elffile), instances are restored from a snapshot.
+     */
+    if (elffile) {
+        image_fd = image_create(mem_size);
+        image_size = mem_size;
+        mem = mmap(NULL, mem_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                image_fd, 0);
+        if (mem == MAP_FAILED)
+            err(1, "Zygote: Could not map guest image");
+        /*
+         * Instances only see what is in the image, so copy all of the binary
+         * into it. The protections of its segments are lost with this
+         * mapping, and applied again by ukvm_zygote_map().
+         */
+        ukvm_elf_load(elffile, mem, mem_size, 0, gpa_ep, gpa_kend);
+        munmap(mem, mem_size);
+    }
+
+    listenfd = listen_on(path);
+    /*
+     * Instances are not waited for; the connection tells the client when one
+     * exits.
+     */
+    signal(SIGCHLD, SIG_IGN);
+    warnx("Zygote: Listening on %s", path);
+
+    while (1) {
+        conn = accept(listenfd, NULL, NULL);
+        if (conn == -1) {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            err(1, "Zygote: accept() failed");
+        }
+
+        /*
+         * Requests are served one at a time, so do not let a client which
+         * does not send one hold up the others.
+         */
+        if (setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof tv) == -1)
+            err(1, "Zygote: setsockopt(SO_RCVTIMEO) failed");
+        n = recv_request(conn, buf, fds, &nfds);
+        if (n == -1) {
+            reply.pid = -1;
+            reply.error = EINVAL;
+            pid = -1;
+        }
+        else {
+            pid = fork();
+            if (pid == 0)
+                break;
+            reply.pid = pid;
+            reply.error = (pid == -1) ? errno : 0;
+        }
+        (void)send(conn, &reply, sizeof reply, MSG_NOSIGNAL);
+        for (i = 0; i < nfds; i++)
+            close(fds[i]);
+        close(conn);
+    }
+
+    /*
+     * New instance.
+     */
+    signal(SIGCHLD, SIG_DFL);
+    setup_instance_fds(listenfd, conn, fds, nfds);
+
+    char **av = calloc(n + 1, sizeof (char *));
+    char *p = buf;
+    if (av == NULL)
+        err(1, "calloc");
+    for (i = 0; i < n; i++) {
+        av[i] = p;
+        p += strlen(p) + 1;
+    }
+    *argc = n;
+    *argv = av;
+}
+
+void ukvm_zygote_map(struct ukvm_hv *hv)
+{
+    int flags = MAP_PRIVATE | MAP_FIXED;
+    void *mem;
+
+    assert(image_fd != -1 && hv->mem_size == image_size);
+#ifdef MAP_NORESERVE
+    flags |= MAP_NORESERVE;
+#endif
+    mem = mmap(hv->mem, hv->mem_size, PROT_READ | PROT_WRITE, flags,
+            image_fd, 0);
+    if (mem == MAP_FAILED)
+        err(1, "Zygote: Could not map guest image");
+    assert(mem == hv->mem);
+    ukvm_elf_protect(hv->mem);
+    close(image_fd);
+    image_fd = -1;
+}
@@ -0,0 +1,52 @@
+/* 
+ * Copyright (c) 2015-2017 Contributors as noted in the AUTHORS file
+ *
+ * This file is part of ukvm, a unikernel monitor.
+ *
+ * Permission to use, copy, modify, and/or distribute this software
+ * for any purpose with or without fee is hereby granted, provided
+ * that the above copyright notice and this permission notice appear
+ * in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR
+ * CONSEQUENTIAL DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS
+ * OF USE, DATA OR PROFITS, WHETHER IN AN ACTION OF CONTRACT,
+ * NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+/*
+ * ukvm_zygote.h: Protocol spoken on the socket of a ukvm zygote (--zygote).
+ *
+ * This header is shared between the monitor and ukvm-launch, and must be kept
+ * self-contained with no external dependencies other than C99 headers.
+ */
+
+#ifndef UKVM_ZYGOTE_H
+#define UKVM_ZYGOTE_H
+
+#include <stdint.h>
+
+/*
+ * A client connects to the zygote's SOCK_SEQPACKET socket and, within
+ * UKVM_ZYGOTE_REQ_TIMEOUT seconds, sends a single request: the instance's [ MODULE OPTIONS ] [ -- ] [ ARGS ] as consecutive
+ * NUL-terminated strings, with up to UKVM_ZYGOTE_FDS_MAX descriptors attached
+ * (SCM_RIGHTS). These become descriptors 0, 1, ... of the instance, so a TAP
+ * device passed as the fourth can be used with --net=@3.
+ *
+ * The zygote replies with a struct ukvm_zygote_reply. The connection is then
+ * held open by the instance, and is closed when it exits.
+ */
+#define UKVM_ZYGOTE_REQ_MAX     16384
+#define UKVM_ZYGOTE_FDS_MAX     8
+#define UKVM_ZYGOTE_REQ_TIMEOUT 1
+
+struct ukvm_zygote_reply {
+    int32_t pid;                /* Of the instance, or -1 on failure */
+    int32_t error;              /* errno on failure */
+};
+
+#endif /* UKVM_ZYGOTE_H */